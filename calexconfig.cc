@@ -32,6 +32,18 @@
  * 14/03/2012   V0.1    Daniel Armbruster
  * 05/07/2012   V0.1.1  add whitespace before parameter file namings in write
  *                      function
+ * 17/10/2026   V0.2    Write parameter file referring to relocated signal
+ *                      files.
+ * 17/10/2026   V0.3    Freeze the configuration into an immutable snapshot;
+ *                      do not write stray newlines to stdout.
+ * 17/10/2026   V0.4    Coordinate table of grid system parameters; bug fix
+ *                      clearing first order subsystems and removing second
+ *                      order subsystems with a grid damping.
+ * 17/10/2026   V0.5    Coordinate maps and snapshots of subgrids.
+ * 17/10/2026   V0.6    Refreeze lazily after modifications; discard the
+ *                      snapshots while invalidating.
+ * 17/10/2026   V0.7    Freeze snapshots of subgrids on request.
+ * 17/10/2026   V0.8    Clear the modification flag before refreezing.
  *
  * ============================================================================
  */
@@ -41,6 +53,7 @@
 #include <iomanip>
 #include <algorithm>
 #include <calexxx/calexconfig.h>
+#include <calexxx/snapshot.h>
 #include <calexxx/error.h>
 
 namespace calex
@@ -54,14 +67,17 @@ namespace calex
       Mdel(new SystemParameter("del",0.,0.)), 
       Msub(new SystemParameter("sub",0.,0.)),
       Mtil(new SystemParameter("til",0.,0.)), 
-      MisSynchronized(false)
+      MisSynchronized(false), Mmodified(false)
   { }
 
   /*-------------------------------------------------------------------------*/
   void CalexConfig::set_amp(std::shared_ptr<SystemParameter> amp)
   {
     if ((! Mamp || !Mamp->is_active()) && amp->is_active()) { ++Mm; }
-    Mamp = amp; 
+    if ((Mamp && Mamp->is_gridSystemParameter()) ||
+        amp->is_gridSystemParameter()) { invalidate(); }
+    Mamp = amp;
+    Mmodified = true;
   }
 
   /*-------------------------------------------------------------------------*/
@@ -74,7 +90,10 @@ namespace calex
           "Assignment not valid.");
     }
     if ((! Mdel || !Mdel->is_active()) && del->is_active()) { ++Mm; }
-    Mdel = del; 
+    if ((Mdel && Mdel->is_gridSystemParameter()) ||
+        del->is_gridSystemParameter()) { invalidate(); }
+    Mdel = del;
+    Mmodified = true;
   }
 
   /*-------------------------------------------------------------------------*/
@@ -87,14 +106,20 @@ namespace calex
           "Assignment not valid.");
     }
     if ((! Msub || !Msub->is_active()) && sub->is_active()) { ++Mm; }
-    Msub = sub; 
+    if ((Msub && Msub->is_gridSystemParameter()) ||
+        sub->is_gridSystemParameter()) { invalidate(); }
+    Msub = sub;
+    Mmodified = true;
   }
 
   /*-------------------------------------------------------------------------*/
   void CalexConfig::set_til(std::shared_ptr<SystemParameter> til)
   {
     if ((! Mtil || !Mtil->is_active()) && til->is_active()) { ++Mm; }
+    if ((Mtil && Mtil->is_gridSystemParameter()) ||
+        til->is_gridSystemParameter()) { invalidate(); }
     Mtil = til;
+    Mmodified = true;
   }
 
   /*-------------------------------------------------------------------------*/
@@ -105,26 +130,27 @@ namespace calex
     std::vector<std::string>::iterator it(
         find(names.begin(), names.end(), param->get_nam()));
     CALEX_assert(names.end() == it, "Illegal parameter added.");
+    if (param->is_gridSystemParameter()) { invalidate(); }
     MsystemParameters.push_back(param);
+    Mmodified = true;
   }
 
   /*-------------------------------------------------------------------------*/
   void CalexConfig::add_subsystem(std::shared_ptr<CalexSubsystem> subsys)
   { 
     if (0 != subsys->get_per()->get_unc()) { ++Mm; }
-    if (subsys->get_per()->is_gridSystemParameter())
-    { MisSynchronized = false; }
+    if (subsys->get_per()->is_gridSystemParameter()) { invalidate(); }
     if (1 == subsys->get_order()) { ++Mm1; } else
     if (2 == subsys->get_order())
     { 
       ++Mm2;
       if (0 != subsys->get_dmp()->get_unc()) { ++Mm; }
-      if (subsys->get_dmp()->is_gridSystemParameter())
-      { MisSynchronized = false; }
+      if (subsys->get_dmp()->is_gridSystemParameter()) { invalidate(); }
     }
     else { CALEX_abort("Illegal subsystem type."); }
 
     MsubSystems.push_back(subsys);
+    Mmodified = true;
   } // function CalexConfig::add_subsystem
 
   /*-------------------------------------------------------------------------*/
@@ -133,23 +159,17 @@ namespace calex
     for (auto it(MsubSystems.begin()); it != MsubSystems.end(); ++it)
     {
       if (0 != (*it)->get_per()->get_unc()) { --Mm; }
-      if ((*it)->get_per()->is_gridSystemParameter()) 
-      { MisSynchronized = false; }
-      if (2 == (*it)->get_order() && 0 != (*it)->get_dmp()->get_unc())  
+      if ((*it)->get_per()->is_gridSystemParameter()) { invalidate(); }
+      if (2 == (*it)->get_order())
       { 
-        if ((*it)->get_dmp()->is_gridSystemParameter()) 
-        { 
-          MisSynchronized = false;
-        }
-        --Mm;
-      } else
-      {
-        CALEX_abort("Illegal order of subsystem.");
+        if (0 != (*it)->get_dmp()->get_unc()) { --Mm; }
+        if ((*it)->get_dmp()->is_gridSystemParameter()) { invalidate(); }
       }
     }
     Mm1 = 0;
     Mm2 = 0;
     MsubSystems.clear();
+    Mmodified = true;
   } // function CalexConfig::clear_subsystems
 
   /*-------------------------------------------------------------------------*/
@@ -159,19 +179,16 @@ namespace calex
     if (it != MsubSystems.end())
     {
       if (0 != (*it)->get_per()->get_unc()) { --Mm; }
-      if (subsys->get_per()->is_gridSystemParameter())
-      { MisSynchronized = false; }
+      if (subsys->get_per()->is_gridSystemParameter()) { invalidate(); }
       if (2 == (*it)->get_order())
       {
         if (0 != (*it)->get_dmp()->get_unc()) { --Mm; }
-        if (subsys->get_per()->is_gridSystemParameter())
-        { 
-          MisSynchronized = false;
-        }
+        if (subsys->get_dmp()->is_gridSystemParameter()) { invalidate(); }
         --Mm2;
       }
       if (1 == (*it)->get_order()) { --Mm1; }
       MsubSystems.erase(it);
+      Mmodified = true;
     }
   } // function CalexConfig::remove_subsystem
 
@@ -191,10 +208,40 @@ namespace calex
 
   /*-------------------------------------------------------------------------*/
   void CalexConfig::write(std::ostream& os) const
+  {
+    writeRelocated(os, Minfile, Moutfile);
+  } // function CalexConfig::write
+
+  /*-------------------------------------------------------------------------*/
+  void CalexConfig::writeRelocated(std::ostream& os, std::string const& infile,
+      std::string const& outfile) const
   {
     os << Mcomment << "\n" << std::endl;
-    os << "'" << Minfile << "'  input to seismo (file name)" << std::endl 
-      << "'" << Moutfile << "'  output from seismo (file name)\n" << std::endl;
+    os << "'" << infile << "'  input to seismo (file name)" << std::endl 
+      << "'" << outfile << "'  output from seismo (file name)\n" << std::endl;
+    writeControlParameters(os);
+    os << *Mamp << *Mdel << *Msub << *Mtil << std::endl;
+    for (auto cit(MsystemParameters.cbegin()); cit != MsystemParameters.cend();
+        ++cit)
+    {
+      os << **cit;
+    }
+    // write first order subsystems
+    for (auto cit(MsubSystems.begin()); cit != MsubSystems.end(); ++cit)
+    {
+      if (1 == (*cit)->get_order()) { os << **cit << std::endl; }
+    }
+    // write second order subsystems
+    for (auto cit(MsubSystems.begin()); cit != MsubSystems.end(); ++cit)
+    {
+      if (2 == (*cit)->get_order()) { os << **cit << std::endl; }
+    }
+    os << "end" << std::endl;
+  } // function CalexConfig::writeRelocated
+
+  /*-------------------------------------------------------------------------*/
+  void CalexConfig::writeControlParameters(std::ostream& os) const
+  {
     std::stringstream ss;
     ss.precision(5);
     ss << std::setw(6) << std::left << std::fixed << Malias << " alias" 
@@ -211,25 +258,70 @@ namespace calex
       << std::setw(10) << std::left << Mns1 << " ns1" << std::endl
       << std::setw(10) << std::left << Mns2 << " ns2" << std::endl;
     os << ss.str() << std::endl;
-    os << *Mamp << *Mdel << *Msub << *Mtil << std::endl;
-    for (auto cit(MsystemParameters.cbegin()); cit != MsystemParameters.cend();
-        ++cit)
-    {
-      os << **cit;
-    }
-    std::cout << std::endl;
-    // write first order subsystems
-    for (auto cit(MsubSystems.begin()); cit != MsubSystems.end(); ++cit)
-    {
-      if (1 == (*cit)->get_order()) { os << **cit << std::endl; }
-    }
-    // write second order subsystems
-    for (auto cit(MsubSystems.begin()); cit != MsubSystems.end(); ++cit)
+  } // function CalexConfig::writeControlParameters
+
+  /*-------------------------------------------------------------------------*/
+  void CalexConfig::buildCoordinateTable(
+      std::vector<std::shared_ptr<GridSystemParameter>> const& grid_params)
+  {
+    McoordinateTable.assign(grid_params.size(),
+        std::shared_ptr<GridSystemParameter>());
+    for (auto cit(grid_params.cbegin()); cit != grid_params.cend(); ++cit)
     {
-      if (2 == (*cit)->get_order()) { os << **cit << std::endl; }
+      int const id = (*cit)->get_coordinateId();
+      CALEX_assert(id >= 0 && static_cast<size_t>(id) < grid_params.size()
+          && ! McoordinateTable[id],
+          "Invalid liboptimizexx parameter configuration.");
+      McoordinateTable[id] = *cit;
     }
-    os << "end" << std::endl;
-  } // function CalexConfig::write
+  } // function CalexConfig::buildCoordinateTable
+
+  /*-------------------------------------------------------------------------*/
+  void CalexConfig::invalidate()
+  {
+    MisSynchronized = false;
+    McoordinateTable.clear();
+    boost::mutex::scoped_lock lock(MfreezeMutex);
+    // the snapshot refers to the former parameter space
+    Msnapshot.reset();
+  } // function CalexConfig::invalidate
+
+  /*-------------------------------------------------------------------------*/
+  void CalexConfig::freeze()
+  {
+    boost::mutex::scoped_lock lock(MfreezeMutex);
+    refreeze();
+  } // function CalexConfig::freeze
+
+  /*-------------------------------------------------------------------------*/
+  void CalexConfig::refreeze() const
+  {
+    // modifications while refreezing mark the new snapshot outdated
+    Mmodified = false;
+    Msnapshot.reset(new ConfigSnapshot(*this));
+  } // function CalexConfig::refreeze
+
+  /*-------------------------------------------------------------------------*/
+  std::shared_ptr<ConfigSnapshot const> CalexConfig::get_snapshot() const
+  {
+    boost::mutex::scoped_lock lock(MfreezeMutex);
+    CALEX_assert(Msnapshot,
+        "Configuration not frozen or not synchronized since modified.");
+    if (Mmodified) { refreeze(); }
+    return Msnapshot;
+  } // function CalexConfig::get_snapshot
+
+  /*-------------------------------------------------------------------------*/
+  std::shared_ptr<ConfigSnapshot const> CalexConfig::freezeSubgrid(
+      std::vector<unsigned int> const& coordinates,
+      std::vector<double> const& fixed) const
+  {
+    CALEX_assert(MisSynchronized, "Parameters not synchronized.");
+    boost::mutex::scoped_lock lock(MfreezeMutex);
+    // validates the coordinate map
+    return std::shared_ptr<ConfigSnapshot const>(
+        new ConfigSnapshot(*this, coordinates, fixed));
+  } // function CalexConfig::freezeSubgrid
 
   /*-------------------------------------------------------------------------*/
   void CalexConfig::get_gridSystemParameters(
@@ -32,6 +32,22 @@
  * 14/03/2012   V0.1  Daniel Armbruster
  * 15/05/2012   V0.2  Query function for grid system parameter names provided
  * 05/07/2012   V0.3  Query function for number of active parameters added.
+ * 17/10/2026   V0.4  Write parameter file referring to relocated signal
+ *                    files.
+ * 17/10/2026   V0.5  Query function for additional system parameters.
+ * 17/10/2026   V0.6  Freeze the configuration into an immutable snapshot.
+ * 17/10/2026   V0.7  Update grid system parameters by means of a coordinate
+ *                    table built while synchronizing.
+ * 17/10/2026   V0.8  Friend declaration of calex::FlatConfig.
+ * 17/10/2026   V0.9  Re-entrant synchronizing; coordinate maps of subgrids.
+ * 17/10/2026   V0.10 Friend declaration of calex::ResultStore.
+ * 17/10/2026   V0.11 Friend declaration of calex::GridAxes instead of
+ *                    calex::ResultStore.
+ * 17/10/2026   V0.12 Refreeze the snapshot after the configuration was
+ *                    modified; structural changes discard it.
+ * 17/10/2026   V0.13 Snapshots of subgrids are frozen on request instead of
+ *                    being registered by the address of the subgrid.
+ * 17/10/2026   V0.14 The modification flag is atomic.
  * 
  * ============================================================================
  */
@@ -42,6 +58,8 @@
 #include <vector>
 #include <ostream>
 #include <algorithm>
+#include <atomic>
+#include <boost/thread.hpp>
 #include <optimizexx/application.h>
 #include <calexxx/systemparameter.h>
 #include <calexxx/subsystem.h>
@@ -58,6 +76,9 @@ namespace opt = optimize;
 
 namespace calex
 {
+  class ConfigSnapshot;
+  class FlatConfig;
+  class GridAxes;
 
   /*=========================================================================*/
   /*!
@@ -66,9 +87,24 @@ namespace calex
    * \note Notice that only either CalexConfig::Mdmp or CalexConfig::Msub can
    * be set.
    *
-   * \todo Synchronizing class calex::CalexConfig several times does not work
-   * yet. This especially is a problem if using other global algorithms which
-   * make use of refining the parameter space and adding subgrids.\n
+   * From V0.9 CalexConfig::synchronize may be called several times e.g.
+   * after a refining global algorithm rebuilt its parameter space. Subgrids
+   * of lower dimension than the parameter space are rendered from snapshots
+   * frozen for their coordinate map (see CalexConfig::get_snapshot); grid
+   * system parameters the subgrid does not vary are fixed at the values
+   * passed.\n
+   *
+   * From V0.6 the configuration is frozen into an immutable
+   * calex::ConfigSnapshot while synchronizing (see CalexConfig::freeze).
+   * Parameter files of nodes are rendered from the snapshot and the node's
+   * coordinates without modifying any shared state.\n
+   *
+   * From V0.12 the member access functions mark the configuration modified
+   * and CalexConfig::get_snapshot refreezes it lazily. Changes affecting the
+   * grid system parameters additionally discard the snapshot; the
+   * configuration then must be synchronized again. Modify the configuration
+   * only between sweeps; calex::CalexApplication takes the snapshot once
+   * per grid visited.
    *
    * 
    */
@@ -80,14 +116,16 @@ namespace calex
       //! destructor
       ~CalexConfig() { }
       // member access functions
-      void set_comment(std::string const comment) { Mcomment = comment; }
-      void set_alias(float const alias) { Malias = alias; }
-      void set_m0(int m0) { Mm0 = m0; }
-      void set_maxit(unsigned int const maxit) { Mmaxit = maxit; }
-      void set_qac(double const qac) { Mqac = qac; }
-      void set_finac(double const finac) { Mfinac = finac; }
-      void set_ns1(int const ns1) { Mns1 = ns1; }
-      void set_ns2(int const ns2) { Mns2 = ns2; }
+      void set_comment(std::string const comment)
+      { Mcomment = comment; Mmodified = true; }
+      void set_alias(float const alias) { Malias = alias; Mmodified = true; }
+      void set_m0(int m0) { Mm0 = m0; Mmodified = true; }
+      void set_maxit(unsigned int const maxit)
+      { Mmaxit = maxit; Mmodified = true; }
+      void set_qac(double const qac) { Mqac = qac; Mmodified = true; }
+      void set_finac(double const finac) { Mfinac = finac; Mmodified = true; }
+      void set_ns1(int const ns1) { Mns1 = ns1; Mmodified = true; }
+      void set_ns2(int const ns2) { Mns2 = ns2; Mmodified = true; }
       //! member access functions
       void set_amp(std::shared_ptr<SystemParameter> amp);
       void set_del(std::shared_ptr<SystemParameter> del);
@@ -123,12 +161,55 @@ namespace calex
        * calex::CalexApplication.\n
        * Call this function if all parameters had been added before the visitor
        * class calex::CalexApplication will be send through the parameter
-       * space.
+       * space.\n
+       * Synchronizing again (e.g. after the global algorithm rebuilt its
+       * parameter space) reassigns the coordinate ids and refreezes the
+       * snapshot of the configuration.
        *
        * \param algo Global algorithm in use.
        */
       template <typename Ctype>
       void synchronize(opt::GlobalAlgorithm<Ctype, CalexResult>& algo);
+      /*!
+       * Freeze the configuration into an immutable snapshot.\n
+       * Called by CalexConfig::synchronize. Modifications by the member
+       * access functions are frozen lazily by CalexConfig::get_snapshot.
+       * Call this function after modifying system parameters in place.
+       */
+      void freeze();
+      /*!
+       * query function for the snapshot of the configuration
+       *
+       * Refreezes the configuration if it was modified since the last call
+       * of CalexConfig::freeze.
+       *
+       * \return snapshot of the configuration
+       */
+      std::shared_ptr<ConfigSnapshot const> get_snapshot() const;
+      /*!
+       * freeze the configuration for a subgrid of the parameter space
+       *
+       * A subgrid varies some of the coordinates of the parameter space
+       * (e.g. a refinement around the best node found so far) and fixes the
+       * remaining ones. Pass the snapshot to a calex::SubgridVisitor
+       * visiting the subgrid. The configuration must be synchronized
+       * before.
+       *
+       * \param coordinates Coordinate ids of the parameter space the
+       * coordinates of the subgrid's nodes correspond to.
+       * \param fixed Coordinates of the parameter space. Grid system
+       * parameters not varied by the subgrid are fixed at these values.
+       *
+       * \return snapshot of the subgrid
+       */
+      template <typename Ctype>
+      std::shared_ptr<ConfigSnapshot const> get_snapshot(
+          std::vector<unsigned int> const& coordinates,
+          std::vector<Ctype> const& fixed) const
+      {
+        return freezeSubgrid(coordinates,
+            std::vector<double>(fixed.begin(), fixed.end()));
+      }
       /*!
        * query function for grid system parameter names
        * 
@@ -145,14 +226,33 @@ namespace calex
       //! query function for number of active parameters in inversion
       unsigned int get_numActiveParameters() const { return Mm; }
       unsigned int get_maxit() const { return Mmaxit; }
+      //! query function for filename of the calibration signal
+      std::string const& get_infile() const { return Minfile; }
+      //! query function for filename of the seismometer output signal
+      std::string const& get_outfile() const { return Moutfile; }
       //! member query functions
       SystemParameter const& get_amp() const { return *Mamp; }
       SystemParameter const& get_del() const { return *Mdel; }
       SystemParameter const& get_sub() const { return *Msub; }
       SystemParameter const& get_til() const { return *Mtil; }
+      std::vector<std::shared_ptr<SystemParameter>> const&
+        get_systemParameters() const { return MsystemParameters; }
       std::vector<std::shared_ptr<CalexSubsystem>> const& 
         get_subsystems() const;
 
+      /*!
+       * write the parameter file referring to other signal files
+       *
+       * Convenient if calex is run in a scratch directory containing links
+       * to the signal files (see calex::ScratchDirectory).
+       *
+       * \param os output stream
+       * \param infile filename of the calibration signal
+       * \param outfile filename of the seismometer output signal
+       */
+      void writeRelocated(std::ostream& os, std::string const& infile,
+          std::string const& outfile) const;
+
       //! overloaded ostream operator
       friend std::ostream& operator<<(
           std::ostream& os, CalexConfig const& config);
@@ -162,6 +262,27 @@ namespace calex
       virtual void write(std::ostream&) const;
 
     private:
+      //! write the control parameters of the iteration
+      void writeControlParameters(std::ostream& os) const;
+      /*!
+       * build the table mapping coordinate ids to grid system parameters
+       *
+       * \param grid_params synchronized grid system parameters
+       */
+      void buildCoordinateTable(
+          std::vector<std::shared_ptr<GridSystemParameter>> const& grid_params);
+      //! discard the state of synchronization and the snapshots
+      void invalidate();
+      /*!
+       * freeze the configuration
+       *
+       * \note The caller must hold CalexConfig::MfreezeMutex.
+       */
+      void refreeze() const;
+      //! freeze the configuration for a subgrid
+      std::shared_ptr<ConfigSnapshot const> freezeSubgrid(
+          std::vector<unsigned int> const& coordinates,
+          std::vector<double> const& fixed) const;
       /*! 
        * query function for grid system parameters
        *
@@ -254,6 +375,21 @@ namespace calex
       std::vector<std::shared_ptr<CalexSubsystem>> MsubSystems;
       //! flag to save the state of synchronization
       bool MisSynchronized;
+      /*!
+       * grid system parameters indexed by their coordinate id (valid while
+       * CalexConfig::MisSynchronized is set)
+       */
+      std::vector<std::shared_ptr<GridSystemParameter>> McoordinateTable;
+      //! immutable snapshot of the configuration
+      mutable std::shared_ptr<ConfigSnapshot const> Msnapshot;
+      //! flag set if the configuration was modified since freezing
+      mutable std::atomic<bool> Mmodified;
+      //! mutex serializing refreezing and access to the snapshot
+      mutable boost::mutex MfreezeMutex;
+
+      friend class ConfigSnapshot;
+      friend class FlatConfig;
+      friend class GridAxes;
 
   }; // class CalexConfig
 
@@ -263,20 +399,11 @@ namespace calex
   {
     CALEX_assert(MisSynchronized,
         "Parameters not synchronized.");
-    std::vector<std::shared_ptr<GridSystemParameter>> grid_params;
-    get_gridSystemParameters(grid_params);
-    CALEX_assert(data.size() == grid_params.size(),
+    CALEX_assert(data.size() == McoordinateTable.size(),
         "Invalid parameter configuration.");
     for (size_t idx=0; idx < data.size(); ++idx)
     {
-      for (auto it(grid_params.begin()); it != grid_params.end(); ++it)
-      {
-        if(idx == static_cast<size_t>((*it)->get_coordinateId()))
-        {
-          (*it)->set_val(data[idx]);
-          break;
-        }
-      }
+      McoordinateTable[idx]->set_val(data[idx]);
     }
   } // function template CalexConfig::update
 
@@ -298,7 +425,9 @@ namespace calex
     {
       grid_params.at(j)->set_coordinateId(order.at(j));
     }
+    buildCoordinateTable(grid_params);
     MisSynchronized = true;
+    freeze();
   } // function template CalexConfig::synchronize
 
   /*-------------------------------------------------------------------------*/
@@ -0,0 +1,373 @@
+/*! \file calexoutput.cc
+ * \brief Implementation of a model of the complete calex output.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Implementation of a model of the complete calex output.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ *
+ * ============================================================================
+ */
+
+#include <fstream>
+#include <sstream>
+#include <cmath>
+#include <cstring>
+#include <calexxx/calexoutput.h>
+#include <calexxx/resultparser.h>
+#include <calexxx/error.h>
+
+namespace calex
+{
+  namespace
+  {
+    //! split a line into whitespace separated tokens
+    void split(std::string const& text, size_t const begin, size_t const end,
+        std::vector<std::string>& tokens)
+    {
+      tokens.clear();
+      std::istringstream iss(text.substr(begin, end-begin));
+      std::string token;
+      while (iss >> token) { tokens.push_back(token); }
+    }
+
+    /*-----------------------------------------------------------------------*/
+    //! convert a token completely into a number
+    bool toNumber(std::string const& token, double& value)
+    {
+      char const* begin = token.data();
+      char const* end = begin+token.size();
+      return ! token.empty() && parseNumber(begin, end, value) == end;
+    }
+
+    /*-----------------------------------------------------------------------*/
+    //! end of the line starting at \a pos
+    size_t lineEnd(std::string const& text, size_t const pos)
+    {
+      size_t const eol = text.find('\n', pos);
+      return std::string::npos == eol ? text.size() : eol;
+    }
+
+    /*-----------------------------------------------------------------------*/
+    //! check if the line starting at \a pos begins with \a prefix
+    bool startsWith(std::string const& text, size_t pos, char const* prefix)
+    {
+      while (pos < text.size() && (' ' == text[pos] || '\t' == text[pos]))
+      {
+        ++pos;
+      }
+      return 0 == text.compare(pos, strlen(prefix), prefix);
+    }
+
+  } // namespace (unnamed)
+
+  /*=========================================================================*/
+  CalexOutput::CalexOutput(std::string const& text, bool const lazy) :
+    Mtext(text), Mzeros(0)
+  {
+    for (int i = 0; i < NumSections; ++i) { Mdecoded[i] = false; }
+    index();
+    if (! lazy)
+    {
+      for (int i = 0; i < NumSections; ++i)
+      {
+        decode(static_cast<Esection>(i));
+      }
+    }
+  }
+
+  /*-------------------------------------------------------------------------*/
+  std::shared_ptr<CalexOutput> CalexOutput::readFile(std::string const& path,
+      bool const lazy)
+  {
+    std::ifstream ifs(path.c_str());
+    if (! ifs) { return std::shared_ptr<CalexOutput>(); }
+    std::ostringstream oss;
+    oss << ifs.rdbuf();
+    return std::shared_ptr<CalexOutput>(new CalexOutput(oss.str(), lazy));
+  } // function CalexOutput::readFile
+
+  /*-------------------------------------------------------------------------*/
+  void CalexOutput::index()
+  {
+    for (int i = 0; i < NumSections; ++i) { Moffsets[i] = std::string::npos; }
+    for (size_t pos = 0; pos < Mtext.size(); pos = lineEnd(Mtext, pos)+1)
+    {
+      if (startsWith(Mtext, pos, "reading start parameters"))
+      {
+        Moffsets[StartSection] = lineEnd(Mtext, pos)+1;
+      } else
+      // the first table header precedes the iteration table
+      if (std::string::npos == Moffsets[HistorySection] &&
+          std::string::npos == Moffsets[ResultSection] &&
+          startsWith(Mtext, pos, "iter "))
+      {
+        Moffsets[HistorySection] = pos;
+      } else
+      if (startsWith(Mtext, pos, "final system parameters"))
+      {
+        Moffsets[ResultSection] = pos;
+      } else
+      if (startsWith(Mtext, pos, "The Laplace transform has"))
+      {
+        Moffsets[PoleSection] = pos;
+      }
+    }
+  } // function CalexOutput::index
+
+  /*-------------------------------------------------------------------------*/
+  void CalexOutput::decode(Esection const section) const
+  {
+    if (Mdecoded[section]) { return; }
+    Mdecoded[section] = true;
+    switch (section)
+    {
+      case StartSection: decodeStart(); break;
+      case HistorySection: decodeHistory(); break;
+      case ResultSection: decodeResult(); break;
+      case PoleSection: decodePoles(); break;
+      default: CALEX_abort("Illegal section of calex output.");
+    }
+  } // function CalexOutput::decode
+
+  /*-------------------------------------------------------------------------*/
+  void CalexOutput::decodeStart() const
+  {
+    size_t pos = Moffsets[StartSection];
+    if (std::string::npos == pos) { return; }
+    std::vector<std::string> tokens;
+    std::string subsystem;
+    for (; pos < Mtext.size(); pos = lineEnd(Mtext, pos)+1)
+    {
+      split(Mtext, pos, lineEnd(Mtext, pos), tokens);
+      // header of a subsystem e.g. bp2:
+      if (1 == tokens.size() && ':' == tokens[0][tokens[0].size()-1])
+      {
+        subsystem = tokens[0].substr(0, tokens[0].size()-1);
+        continue;
+      }
+      StartParameter param;
+      if ((3 != tokens.size() && 4 != tokens.size()) ||
+          ! toNumber(tokens[1], param.Mval) ||
+          ! toNumber(tokens[2], param.Munc))
+      {
+        break;
+      }
+      param.Mnam = tokens[0];
+      param.Msubsystem = 4 == tokens.size() ? tokens[3] : subsystem;
+      MstartParameters.push_back(param);
+    }
+  } // function CalexOutput::decodeStart
+
+  /*-------------------------------------------------------------------------*/
+  void CalexOutput::decodeHistory() const
+  {
+    size_t pos = Moffsets[HistorySection];
+    if (std::string::npos == pos) { return; }
+    std::vector<std::string> tokens;
+    split(Mtext, pos, lineEnd(Mtext, pos), tokens);
+    CALEX_assert(tokens.size() >= 2, "Error while reading iteration table.");
+    Mnames.assign(tokens.begin()+2, tokens.end());
+    size_t const columns = Mnames.size();
+    for (pos = lineEnd(Mtext, pos)+1; pos < Moffsets[ResultSection] &&
+        pos < Mtext.size(); pos = lineEnd(Mtext, pos)+1)
+    {
+      split(Mtext, pos, lineEnd(Mtext, pos), tokens);
+      if (tokens.empty()) { continue; }
+      if ("+-" == tokens[0])
+      {
+        Muncertainties.resize(tokens.size()-1);
+        for (size_t j = 1; j < tokens.size(); ++j)
+        {
+          CALEX_assert(toNumber(tokens[j], Muncertainties[j-1]),
+              "Error while reading iteration table.");
+        }
+        continue;
+      }
+      std::vector<double> values(tokens.size());
+      bool numeric = tokens.size() == columns+2;
+      for (size_t j = 0; numeric && j < tokens.size(); ++j)
+      {
+        numeric = toNumber(tokens[j], values[j]);
+      }
+      // the table ends with the first line of other output
+      if (! numeric) { break; }
+      Iteration iteration;
+      iteration.Miter = static_cast<unsigned int>(values[0]);
+      iteration.Mrms = values[1];
+      Miterations.push_back(iteration);
+      Mtrajectory.insert(Mtrajectory.end(), values.begin()+2, values.end());
+    }
+  } // function CalexOutput::decodeHistory
+
+  /*-------------------------------------------------------------------------*/
+  void CalexOutput::decodeResult() const
+  {
+    ResultParser parser;
+    parser.parse(Mtext.data(), Mtext.size());
+    parser.get_result(Mresult);
+  } // function CalexOutput::decodeResult
+
+  /*-------------------------------------------------------------------------*/
+  void CalexOutput::decodePoles() const
+  {
+    size_t pos = Moffsets[PoleSection];
+    if (std::string::npos == pos) { return; }
+    std::vector<std::string> tokens;
+    // The Laplace transform has N zero(s) at zero frequency
+    split(Mtext, pos, lineEnd(Mtext, pos), tokens);
+    double value;
+    if (tokens.size() > 4 && toNumber(tokens[4], value))
+    {
+      Mzeros = static_cast<unsigned int>(value);
+    }
+    // numbers following the header lines of the poles
+    size_t real = 0;
+    size_t complex = 0;
+    std::vector<double> numbers;
+    for (pos = lineEnd(Mtext, pos)+1; pos < Mtext.size();
+        pos = lineEnd(Mtext, pos)+1)
+    {
+      split(Mtext, pos, lineEnd(Mtext, pos), tokens);
+      if (tokens.empty()) { continue; }
+      // It has N real poles, in rad/s:
+      if (tokens.size() > 3 && "It" == tokens[0] && "has" == tokens[1] &&
+          toNumber(tokens[2], value))
+      {
+        real = static_cast<size_t>(value);
+        continue;
+      }
+      // and N pair(s) of complex-conjugate poles, in rad/s:
+      if (tokens.size() > 3 && "and" == tokens[0] &&
+          toNumber(tokens[1], value))
+      {
+        complex = 2*static_cast<size_t>(value);
+        continue;
+      }
+      bool numeric = true;
+      for (auto cit(tokens.cbegin()); numeric && cit != tokens.cend(); ++cit)
+      {
+        numeric = toNumber(*cit, value);
+        if (numeric) { numbers.push_back(value); }
+      }
+      if (! numeric) { break; }
+    }
+    // real poles are listed before the complex poles
+    CALEX_assert(numbers.size() >= real+2*complex,
+        "Error while reading poles.");
+    MrealPoles.assign(numbers.begin(), numbers.begin()+real);
+    for (size_t i = 0; i < complex; ++i)
+    {
+      McomplexPoles.push_back(Tpole(numbers[real+2*i], numbers[real+2*i+1]));
+    }
+  } // function CalexOutput::decodePoles
+
+  /*-------------------------------------------------------------------------*/
+  std::vector<CalexOutput::StartParameter> const&
+    CalexOutput::get_startParameters() const
+  {
+    decode(StartSection);
+    return MstartParameters;
+  }
+
+  /*-------------------------------------------------------------------------*/
+  std::vector<std::string> const& CalexOutput::get_names() const
+  {
+    decode(HistorySection);
+    return Mnames;
+  }
+
+  /*-------------------------------------------------------------------------*/
+  std::vector<CalexOutput::Iteration> const&
+    CalexOutput::get_iterations() const
+  {
+    decode(HistorySection);
+    return Miterations;
+  }
+
+  /*-------------------------------------------------------------------------*/
+  std::vector<double> const& CalexOutput::get_trajectory() const
+  {
+    decode(HistorySection);
+    return Mtrajectory;
+  }
+
+  /*-------------------------------------------------------------------------*/
+  std::vector<double> const& CalexOutput::get_uncertainties() const
+  {
+    decode(HistorySection);
+    return Muncertainties;
+  }
+
+  /*-------------------------------------------------------------------------*/
+  CalexResult const& CalexOutput::get_result() const
+  {
+    decode(ResultSection);
+    return Mresult;
+  }
+
+  /*-------------------------------------------------------------------------*/
+  unsigned int CalexOutput::get_zeros() const
+  {
+    decode(PoleSection);
+    return Mzeros;
+  }
+
+  /*-------------------------------------------------------------------------*/
+  std::vector<double> const& CalexOutput::get_realPoles() const
+  {
+    decode(PoleSection);
+    return MrealPoles;
+  }
+
+  /*-------------------------------------------------------------------------*/
+  std::vector<CalexOutput::Tpole> const& CalexOutput::get_complexPoles() const
+  {
+    decode(PoleSection);
+    return McomplexPoles;
+  }
+
+  /*-------------------------------------------------------------------------*/
+  unsigned int CalexOutput::convergedAfter(double const tolerance) const
+  {
+    std::vector<Iteration> const& iterations(get_iterations());
+    if (iterations.empty()) { return get_result().get_iter(); }
+    double const rms = get_result().isComputed() && get_result().get_iter() ?
+      get_result().get_rms() : iterations.back().Mrms;
+    for (auto cit(iterations.cbegin()); cit != iterations.cend(); ++cit)
+    {
+      if (std::fabs(cit->Mrms-rms) <= tolerance*rms) { return cit->Miter; }
+    }
+    return iterations.back().Miter;
+  } // function CalexOutput::convergedAfter
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+/* ----- END OF calexoutput.cc  ----- */
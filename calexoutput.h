@@ -0,0 +1,213 @@
+/*! \file calexoutput.h
+ * \brief Declaration of a model of the complete calex output.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Declaration of a model of the complete calex output.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ *
+ * ============================================================================
+ */
+
+#include <string>
+#include <vector>
+#include <complex>
+#include <memory>
+#include <calexxx/resultdata.h>
+#include <calexxx/error.h>
+
+#ifndef _CALEX_CALEXOUTPUT_H_
+#define _CALEX_CALEXOUTPUT_H_
+
+namespace calex
+{
+  /*=========================================================================*/
+  /*!
+   * Model of the complete output of a calex run (\c *.out file).
+   *
+   * calex::CalexResult only keeps the final block of system parameters.
+   * calex::CalexOutput additionally provides
+   *  - the start parameters including \c sub and \c til
+   *  - the iteration history (RMS and parameter columns of every iteration)
+   *  - the uncertainties (\c +- line of the iteration table)
+   *  - the number of QUAD calls and the convergence
+   *  - the zeros and the real and complex poles of the transfer function
+   *
+   * Sections are located when constructing the model by a single scan over
+   * the line beginnings. A lazy model decodes a section when it is queried
+   * first; querying a lazy model therefore is not thread safe. Construct the
+   * model with \a lazy set to false to decode all sections at once and to
+   * share it between threads.
+   *
+   * Usage:
+   * \code
+   * std::shared_ptr<calex::CalexOutput> output(
+   *     calex::CalexOutput::readFile("calex.out"));
+   * if (calex::NotConverged == output->get_result().get_convergence())
+   * {
+   *   std::cout << output->get_iterations().size() << " iterations\n";
+   * }
+   * \endcode
+   */
+  class CalexOutput
+  {
+    public:
+      //! start parameter read by calex
+      struct StartParameter
+      {
+        //! identifier of system parameter
+        std::string Mnam;
+        //! start value
+        double Mval;
+        //! uncertainty
+        double Munc;
+        //! subsystem the parameter belongs to (e.g. \c bp2), empty otherwise
+        std::string Msubsystem;
+      }; // struct StartParameter
+
+      //! line of the iteration table
+      struct Iteration
+      {
+        //! number of the iteration
+        unsigned int Miter;
+        //! root mean square
+        double Mrms;
+      }; // struct Iteration
+
+      typedef std::complex<double> Tpole;
+
+    public:
+      /*!
+       * constructor
+       *
+       * \param text calex output
+       * \param lazy decode sections on first query
+       */
+      explicit CalexOutput(std::string const& text, bool const lazy=true);
+      /*!
+       * read a calex output file
+       *
+       * \param path path of the \c *.out file
+       * \param lazy decode sections on first query
+       *
+       * \return model of the output or an empty pointer if the file cannot
+       * be read
+       */
+      static std::shared_ptr<CalexOutput> readFile(std::string const& path,
+          bool const lazy=true);
+      //! query function for the output
+      std::string const& get_text() const { return Mtext; }
+      //! query function for the start parameters
+      std::vector<StartParameter> const& get_startParameters() const;
+      //! query function for the parameter columns of the iteration table
+      std::vector<std::string> const& get_names() const;
+      //! query function for the iterations
+      std::vector<Iteration> const& get_iterations() const;
+      /*!
+       * query function for the parameter columns of the iteration table
+       *
+       * \return values of iteration \a i and column \a j at index
+       * \f$ i \cdot n + j \f$ with \a n the number of columns
+       */
+      std::vector<double> const& get_trajectory() const;
+      //! query function for the uncertainties (\c +- line)
+      std::vector<double> const& get_uncertainties() const;
+      //! query function for the result data (final system parameters)
+      CalexResult const& get_result() const;
+      //! query function for the number of zeros at zero frequency
+      unsigned int get_zeros() const;
+      //! query function for the real poles in rad/s
+      std::vector<double> const& get_realPoles() const;
+      //! query function for the complex poles in rad/s
+      std::vector<Tpole> const& get_complexPoles() const;
+      /*!
+       * number of iterations until the RMS came close to its final value
+       *
+       * \param tolerance relative deviation from the final RMS
+       *
+       * \return first iteration whose RMS is within the tolerance
+       */
+      unsigned int convergedAfter(double const tolerance=1e-3) const;
+
+    private:
+      //! sections of the output
+      enum Esection
+      {
+        StartSection,       //!< start parameters
+        HistorySection,     //!< iteration table
+        ResultSection,      //!< final system parameters and QUAD line
+        PoleSection,        //!< zeros and poles
+        NumSections
+      }; // enum Esection
+
+      //! locate the sections
+      void index();
+      //! decode a section if not decoded yet
+      void decode(Esection const section) const;
+      //! decode the start parameters
+      void decodeStart() const;
+      //! decode the iteration table
+      void decodeHistory() const;
+      //! decode the final system parameters
+      void decodeResult() const;
+      //! decode zeros and poles
+      void decodePoles() const;
+
+    private:
+      //! calex output
+      std::string Mtext;
+      //! offsets of the sections (std::string::npos if missing)
+      size_t Moffsets[NumSections];
+      //! sections decoded
+      mutable bool Mdecoded[NumSections];
+      //! start parameters
+      mutable std::vector<StartParameter> MstartParameters;
+      //! parameter columns of the iteration table
+      mutable std::vector<std::string> Mnames;
+      //! iterations
+      mutable std::vector<Iteration> Miterations;
+      //! parameter columns of the iterations
+      mutable std::vector<double> Mtrajectory;
+      //! uncertainties
+      mutable std::vector<double> Muncertainties;
+      //! result data
+      mutable CalexResult Mresult;
+      //! number of zeros at zero frequency
+      mutable unsigned int Mzeros;
+      //! real poles
+      mutable std::vector<double> MrealPoles;
+      //! complex poles
+      mutable std::vector<Tpole> McomplexPoles;
+
+  }; // class CalexOutput
+
+} // namespace calex
+
+#endif // include guard
+
+/* ----- END OF calexoutput.h  ----- */
@@ -36,6 +36,41 @@
  *                      calex parameter filepath with thread ID.
  * 15/04/2012  V0.3     Make update process of class calex::CalexConfig thread
  *                      safe to avoid racing conditions.
+ * 17/10/2026  V0.4     Spawn calex directly by means of calex::CalexLauncher
+ *                      instead of calling system(); report the exit status
+ *                      to the node.
+ * 17/10/2026  V0.5     Provide access to the launcher e.g. to assign a
+ *                      calex::CalexForkServer.
+ * 17/10/2026  V0.6     Optionally run calex in isolated scratch directories.
+ * 17/10/2026  V0.7     Optionally parse calex output from a pipe or memfd.
+ * 17/10/2026  V0.8     Optionally terminate hopeless calex runs early.
+ * 17/10/2026  V0.9     Optionally limit wall-clock and CPU time of calex runs;
+ *                      collect run time statistics.
+ * 17/10/2026  V0.10    Optionally limit the number of simultaneous calex
+ *                      processes.
+ * 17/10/2026  V0.11    Optionally hand off calex runs to an asynchronous
+ *                      executor.
+ * 17/10/2026  V0.12    Optionally place calex processes on CPUs and NUMA
+ *                      nodes.
+ * 17/10/2026  V0.13    Optionally dispatch all nodes of a grid as a batch.
+ * 17/10/2026  V0.14    Optionally evaluate nodes by a pluggable forward
+ *                      engine.
+ * 17/10/2026  V0.15    Render calex parameter files from an immutable
+ *                      snapshot of the configuration without locking.
+ * 17/10/2026  V0.16    Write calex parameter files from a precompiled
+ *                      template.
+ * 17/10/2026  V0.17    Render parameter files of subgrid nodes from the
+ *                      subgrid's snapshot.
+ * 17/10/2026  V0.18    Optionally collect the result data in a columnar
+ *                      store.
+ * 17/10/2026  V0.19    Optionally write the RMS of every node into a misfit
+ *                      cube file.
+ * 17/10/2026  V0.20    Subgrids are visited by calex::SubgridVisitor passing
+ *                      the subgrid's snapshot along with every node.
+ * 17/10/2026  V0.21    Delegate preparing and running calex to
+ *                      calex::ExternalEngine.
+ * 17/10/2026  V0.22    Take the snapshot of the configuration once per grid
+ *                      instead of once per node.
  * 
  * ============================================================================
  */
@@ -45,12 +80,30 @@
 #include <string>
 #include <sstream>
 #include <cstdlib>
+#include <csignal>
+#include <memory>
+#include <set>
+#include <algorithm>
+#include <vector>
 #include <boost/filesystem.hpp>
 #include <boost/thread.hpp>
 #include <calexxx/calexconfig.h>
+#include <calexxx/snapshot.h>
 #include <calexxx/resultdata.h>
+#include <calexxx/launcher.h>
+#include <calexxx/scratchdir.h>
+#include <calexxx/outputchannel.h>
+#include <calexxx/pruning.h>
+#include <calexxx/watchdog.h>
+#include <calexxx/limiter.h>
+#include <calexxx/executor.h>
+#include <calexxx/placement.h>
+#include <calexxx/engine.h>
+#include <calexxx/resultstore.h>
+#include <calexxx/misfitcube.h>
 #include <calexxx/error.h>
 #include <optimizexx/application.h>
+#include <optimizexx/iterator.h>
 
 #ifndef _CALEX_CALEXVISITOR_H_
 #define _CALEX_CALEXVISITOR_H_
@@ -81,6 +134,128 @@ namespace calex
    * \code
    * McalexConfig->update<Ctype>(node->getCoordinates());
    * \endcode
+   * From V0.15 the configuration is not updated anymore. The parameter file
+   * of a node is rendered from the immutable snapshot of the configuration
+   * created while synchronizing (see calex::ConfigSnapshot) and the node's
+   * coordinates. Visiting threads therefore do not serialize generating
+   * parameter files. Since V0.22 the snapshot is taken once when a grid is
+   * visited and shared by the nodes visited afterwards; nodes visited
+   * without a grid take the current snapshot of the configuration.
+   *
+   * From V0.4 calex is spawned directly by calex::CalexLauncher. The calex
+   * executable is resolved once while constructing the application. The
+   * exit status of every calex process is stored within the node's result
+   * data (see calex::CalexResult::get_exitStatus). Only nodes whose calex
+   * process terminated successfully are marked as computed.
+   *
+   * From V0.5 launches optionally can be delegated to a calex::CalexForkServer
+   * which must have been started before the parameter space grid is built:
+   * \code
+   * std::shared_ptr<calex::CalexForkServer> server(
+   *     new calex::CalexForkServer);
+   * server->start();
+   * calex::CalexApplication<double> app(&config);
+   * app.get_launcher().set_forkServer(server);
+   * \endcode
+   *
+   * From V0.6 calex optionally is run in an isolated scratch directory for
+   * every node (see calex::ScratchDirectory and
+   * CalexApplication::set_scratchRoot). Concurrent calex processes then do
+   * not clobber each other's files anymore.
+   *
+   * From V0.7 the calex output optionally is transferred through a pipe or
+   * an anonymous memory file instead of reading the \c *.out file (see
+   * calex::OutputChannel and CalexApplication::set_outputMode).
+   *
+   * From V0.8 calex runs optionally are terminated early if their
+   * intermediate RMS stays well above the best RMS found so far (see
+   * calex::IterationMonitor and CalexApplication::set_pruningPolicy). Such
+   * nodes are not marked as computed and their result data has the status
+   * calex::Pruned. Since the iteration lines must be read while calex is
+   * running pruning requires the output mode calex::StdoutPipe.
+   * \code
+   * app.set_outputMode(calex::StdoutPipe);
+   * app.set_pruningPolicy(calex::PruningPolicy(2., 3));
+   * \endcode
+   *
+   * From V0.9 the wall-clock and CPU time of every calex run optionally is
+   * limited (see calex::RunLimits and CalexApplication::set_runLimits). Runs
+   * exceeding their limits are killed and their result data has the status
+   * calex::TimedOut. The wall-clock times of all runs are collected (see
+   * CalexApplication::get_runStatistics) such that the limits can be tuned:
+   * \code
+   * app.set_runLimits(calex::RunLimits(60., 50));
+   * grid->accept(app);
+   * std::cout << *app.get_runStatistics();
+   * \endcode
+   *
+   * From V0.10 the number of simultaneous calex processes optionally is
+   * limited independently of the number of visitor threads (see
+   * calex::ConcurrencyLimiter and CalexApplication::set_concurrencyLimiter).
+   *
+   * From V0.11 calex runs optionally are handed off to a
+   * calex::CalexExecutor (see CalexApplication::set_executor). Visiting a
+   * node then only writes the calex parameter file and submits the run
+   * without blocking. The node is completed by the thread driving the
+   * executor:
+   * \code
+   * std::shared_ptr<calex::CalexExecutor> executor(
+   *     new calex::CalexExecutor(app.get_launcher(), 64));
+   * app.set_executor(executor);
+   * grid->accept(app);
+   * executor->run();
+   * \endcode
+   *
+   * From V0.12 calex processes optionally are pinned to CPUs and NUMA nodes
+   * (see calex::CpuPlacement and CalexApplication::set_placement).
+   *
+   * From V0.13 all nodes of a grid optionally are dispatched as a single
+   * batch when the grid is visited (see CalexApplication::set_batchDispatch).
+   * The calex parameter files of the batch are written in one pass and the
+   * runs are launched by a pooled calex::CalexExecutor. Nodes dispatched
+   * within a batch are skipped when visited afterwards.
+   *
+   * From V0.14 nodes optionally are evaluated by a calex::ForwardEngine
+   * selected at runtime (see CalexApplication::set_engine) instead of the
+   * external calex pipeline described above. Spawning related options
+   * (executor, batch dispatch, pruning, run limits etc.) then are ignored:
+   * \code
+   * app.set_engine(calex::createEngine<double>("mock"));
+   * \endcode
+   *
+   * From V0.17 nodes of subgrids are rendered from the subgrid's snapshot.
+   * Since V0.20 a subgrid is visited by a calex::SubgridVisitor which
+   * passes the snapshot along with the subgrid's batch and every node (see
+   * CalexApplication::dispatch and CalexApplication::compute):
+   * \code
+   * calex::SubgridVisitor<double> visitor(app,
+   *     config.get_snapshot(coordinates, fixed));
+   * subgrid->accept(visitor);
+   * \endcode
+   * Nodes of a nested subgrid of different dimension are not dispatched
+   * with the batch of their parent grid.
+   *
+   * From V0.18 the result data of every node optionally is collected in a
+   * calex::ResultStore in addition to the node itself (see
+   * CalexApplication::set_resultStore). The best fits then are found by
+   * querying the store instead of traversing the grid:
+   * \code
+   * std::shared_ptr<calex::ResultStore> store(
+   *     new calex::ResultStore(config));
+   * app.set_resultStore(store);
+   * grid->accept(app);
+   * std::vector<size_t> best(store->topk(10));
+   * \endcode
+   * Nodes whose coordinates are not within the store's parameter space
+   * (e.g. nodes of subgrids of another dimension) are not collected.
+   *
+   * From V0.19 the RMS of every node optionally is written into a memory
+   * mapped calex::MisfitCube file while sweeping (see
+   * CalexApplication::set_misfitCube).
+   *
+   * From V0.21 the application delegates writing the parameter files and
+   * running calex to a calex::ExternalEngine it owns. The options of the
+   * calex pipeline above are forwarded to that engine.
    *
    * \note If V2 of the Boost filesystem library in use the program using class
    * template calex::CalexApplication must link against \c boost_thread cause
@@ -98,92 +273,413 @@ namespace calex
        *
        * \param config Calex parameter file configuration.
        * \param verbose Be verbose.
+       * \param program Name or path of the calex executable.
        */
-      CalexApplication(CalexConfig* config, bool verbose=false) :
-        McalexConfig(config), Mverbose(verbose)
+      CalexApplication(CalexConfig* config, bool verbose=false,
+          std::string const program="calex") :
+        McalexConfig(config), Mverbose(verbose), Mexternal(program),
+        MbatchDispatch(false)
       { }
       //! Visit function for a liboptimizexx grid.
       /*!
-       * Does nothing by default.
-       * Since a grid has no coordinates the body of this function is empty.
+       * Takes the snapshot of the configuration the nodes of the grid are
+       * rendered from. If batch dispatch is enabled the nodes of the grid
+       * are dispatched as a batch (see CalexApplication::dispatch).
        *
        * \param grid Grid to be visited.
        */
-      virtual void operator()(opt::Grid<Ctype, TresultType>* grid) { }
+      virtual void operator()(opt::Grid<Ctype, TresultType>* grid);
       //! Visit function / application for a liboptimizexx node.
       /*!
-       * Calculates the sum of the coordinate data or rather the parameters
+       * Computes the node rendered from the snapshot taken when the grid was
+       * visited (see CalexApplication::compute).
        *
        * \param node Node to be visited.
        */
       virtual void operator()(opt::Node<Ctype, TresultType>* node);
+      /*!
+       * dispatch all nodes of a grid as a single batch
+       *
+       * Does nothing unless batch dispatch is enabled (see
+       * CalexApplication::set_batchDispatch). If an executor is assigned to
+       * the application (see CalexApplication::set_executor) the batch is
+       * submitted only. Otherwise an executor keeping as many calex
+       * processes in flight as the concurrency limiter permits (or as cores
+       * are available) is driven until the batch completed.
+       *
+       * \param grid Grid to be dispatched.
+       * \param snapshot Snapshot the parameter files of the grid's nodes are
+       * rendered from. Only nodes of its dimension are dispatched.
+       */
+      void dispatch(opt::Grid<Ctype, TresultType>* grid,
+          ConfigSnapshot const& snapshot);
+      /*!
+       * compute a node unless it was dispatched within a batch
+       *
+       * \param node Node to be computed.
+       * \param snapshot Snapshot the parameter file of the node is rendered
+       * from.
+       */
+      void compute(opt::Node<Ctype, TresultType>* node,
+          ConfigSnapshot const& snapshot);
+      //! query function for the calex process launcher
+      CalexLauncher& get_launcher() { return Mexternal.get_launcher(); }
+      /*!
+       * run calex in isolated scratch directories
+       *
+       * \param root Root directory scratch directories are created in, e.g.
+       * \c /dev/shm. If empty calex is run in the current working directory.
+       */
+      void set_scratchRoot(std::string const& root);
+      /*!
+       * select how calex output is transferred to the application
+       *
+       * \param mode output mode (see calex::EoutputMode)
+       */
+      void set_outputMode(EoutputMode const mode)
+      { Mexternal.set_outputMode(mode); }
+      /*!
+       * terminate hopeless calex runs early
+       *
+       * \param policy pruning policy (see calex::PruningPolicy)
+       */
+      void set_pruningPolicy(PruningPolicy const& policy)
+      { Mexternal.set_pruningPolicy(policy); }
+      //! query function for the best RMS found so far
+      std::shared_ptr<BestRms> get_bestRms() const
+      { return Mexternal.get_bestRms(); }
+      /*!
+       * share the best RMS found so far e.g. with further applications
+       *
+       * \param best best RMS found so far
+       */
+      void set_bestRms(std::shared_ptr<BestRms> best)
+      { Mexternal.set_bestRms(best); }
+      /*!
+       * limit wall-clock and CPU time of every calex run
+       *
+       * \param limits run time limits (see calex::RunLimits)
+       */
+      void set_runLimits(RunLimits const& limits)
+      { Mexternal.set_runLimits(limits); }
+      //! query function for the run time statistics
+      std::shared_ptr<RunStatistics> get_runStatistics() const
+      { return Mexternal.get_runStatistics(); }
+      /*!
+       * gate spawning calex by a concurrency limiter
+       *
+       * \param limiter Limiter which may be shared with further
+       * applications. If empty the number of calex processes is not limited.
+       */
+      void set_concurrencyLimiter(std::shared_ptr<ConcurrencyLimiter> limiter)
+      { Mexternal.set_concurrencyLimiter(limiter); }
+      /*!
+       * hand off calex runs to an asynchronous executor
+       *
+       * \param executor Executor completing the nodes. If empty calex is
+       * run synchronously by the visiting thread.
+       *
+       * \note The concurrency limiter is not consulted for runs handed off
+       * to the executor since the executor limits the number of calex
+       * processes in flight itself.
+       */
+      void set_executor(std::shared_ptr<CalexExecutor> executor)
+      { Mexecutor = executor; }
+      /*!
+       * place calex processes on CPUs and NUMA nodes
+       *
+       * \param placement Placement which may be shared with further
+       * applications. If empty calex processes are not pinned.
+       */
+      void set_placement(std::shared_ptr<CpuPlacement> placement)
+      { Mexternal.set_placement(placement); }
+      /*!
+       * dispatch all nodes of a grid as a batch when the grid is visited
+       *
+       * \param enable enable batch dispatch
+       */
+      void set_batchDispatch(bool const enable) { MbatchDispatch = enable; }
+      /*!
+       * evaluate nodes by a forward engine
+       *
+       * \param engine Engine which may be shared with further applications.
+       * If empty the external calex program is run by the application.
+       */
+      void set_engine(std::shared_ptr<ForwardEngine<Ctype>> engine)
+      { Mengine = engine; }
+      //! query function for the forward engine
+      std::shared_ptr<ForwardEngine<Ctype>> get_engine() const
+      { return Mengine; }
+      /*!
+       * collect the result data of all nodes in a columnar store
+       *
+       * \param store Store covering the parameter space. If empty result
+       * data is stored within the nodes only.
+       */
+      void set_resultStore(std::shared_ptr<ResultStore> store)
+      { Mstore = store; }
+      //! query function for the result store
+      std::shared_ptr<ResultStore> get_resultStore() const { return Mstore; }
+      /*!
+       * write the RMS of all nodes into a misfit cube file
+       *
+       * \param cube Writable cube covering the parameter space. If empty no
+       * cube is written.
+       */
+      void set_misfitCube(std::shared_ptr<MisfitCube> cube) { Mcube = cube; }
       
+    private:
+      /*!
+       * evaluate a node by the forward engine
+       *
+       * \param node Node to be computed.
+       * \param snapshot Snapshot the node is evaluated with.
+       */
+      void evaluate(opt::Node<Ctype, TresultType>* node,
+          ConfigSnapshot const& snapshot);
+      /*!
+       * write the calex parameter file of a node
+       *
+       * \param node Node to be computed.
+       * \param snapshot Snapshot the parameter file is rendered from.
+       *
+       * \return description of the calex run completing the node
+       */
+      CalexRun prepare(opt::Node<Ctype, TresultType>* node,
+          ConfigSnapshot const& snapshot);
+      /*!
+       * store the result data in the node
+       *
+       * \param node Node the calex run belongs to.
+       * \param result Result data of the calex run.
+       */
+      void finish(opt::Node<Ctype, TresultType>* node,
+          TresultType const& result);
+
     private:
       //! calex parameter file configuration
       CalexConfig* McalexConfig;
       //! be verbose
       bool Mverbose;
-      //! mutual exclusion variable to guarantee thread safety
-      boost::mutex Mmutex; 
+      //! engine preparing and running calex
+      ExternalEngine<Ctype> Mexternal;
+      //! snapshot of the configuration taken when visiting the grid
+      std::shared_ptr<ConfigSnapshot const> Msnapshot;
+      //! asynchronous executor
+      std::shared_ptr<CalexExecutor> Mexecutor;
+      //! dispatch all nodes of a grid as a batch
+      bool MbatchDispatch;
+      //! nodes dispatched within a batch and not visited yet
+      std::set<opt::Node<Ctype, TresultType>*> Mbatched;
+      //! mutual exclusion variable protecting CalexApplication::Mbatched
+      boost::mutex Mmutex;
+      //! forward engine
+      std::shared_ptr<ForwardEngine<Ctype>> Mengine;
+      //! columnar store of the result data
+      std::shared_ptr<ResultStore> Mstore;
+      //! misfit cube file
+      std::shared_ptr<MisfitCube> Mcube;
 
   }; // class template CalexApplication
 
   /*=========================================================================*/
+  /*!
+   * Visitor of a subgrid of the parameter space.
+   *
+   * Forwards the subgrid and its nodes to a calex::CalexApplication together
+   * with the snapshot frozen for the subgrid (see CalexConfig::get_snapshot).
+   * Since the snapshot is passed along with every node, subgrids of the same
+   * dimension fixing different coordinates may be visited concurrently.
+   */
+  template <typename Ctype>
+  class SubgridVisitor :
+      public opt::ParameterSpaceVisitor<Ctype, TresultType>
+  {
+    public:
+      /*!
+       * constructor
+       *
+       * \param application Application computing the nodes.
+       * \param snapshot Snapshot of the subgrid.
+       */
+      SubgridVisitor(CalexApplication<Ctype>& application,
+          std::shared_ptr<ConfigSnapshot const> snapshot) :
+        Mapplication(application), Msnapshot(snapshot)
+      { CALEX_assert(Msnapshot, "Invalid subgrid snapshot."); }
+      //! Visit function for a liboptimizexx grid.
+      virtual void operator()(opt::Grid<Ctype, TresultType>* grid)
+      { Mapplication.dispatch(grid, *Msnapshot); }
+      //! Visit function for a liboptimizexx node.
+      virtual void operator()(opt::Node<Ctype, TresultType>* node)
+      { Mapplication.compute(node, *Msnapshot); }
+
+    private:
+      //! application computing the nodes
+      CalexApplication<Ctype>& Mapplication;
+      //! snapshot of the subgrid
+      std::shared_ptr<ConfigSnapshot const> Msnapshot;
+
+  }; // class template SubgridVisitor
+
+  /*=========================================================================*/
+  template <typename Ctype>
+  void CalexApplication<Ctype>::set_scratchRoot(std::string const& root)
+  {
+    std::string const& infile(McalexConfig->get_infile());
+    std::string const& outfile(McalexConfig->get_outfile());
+    CALEX_assert(root.empty() ||
+        infile.substr(infile.find_last_of('/')+1) !=
+        outfile.substr(outfile.find_last_of('/')+1),
+        "Signal files must have distinct filenames.");
+    Mexternal.set_scratchRoot(root);
+  } // function CalexApplication<Ctype>::set_scratchRoot
+
+  /*-------------------------------------------------------------------------*/
+  template <typename Ctype>
+  void CalexApplication<Ctype>::operator()(opt::Grid<Ctype, TresultType>* grid)
+  {
+    std::shared_ptr<ConfigSnapshot const> snapshot(
+        McalexConfig->get_snapshot());
+    // nested grids of an unmodified configuration share the snapshot
+    if (snapshot != Msnapshot) { Msnapshot = snapshot; }
+    if (! MbatchDispatch || Mengine) { return; }
+    dispatch(grid, *snapshot);
+  } // function CalexApplication<Ctype>::operator()
+
+  /*-------------------------------------------------------------------------*/
   template <typename Ctype>
   void CalexApplication<Ctype>::operator()(opt::Node<Ctype, TresultType>* node)
   {
-    fs::path param_path;
-    // thread safe part
+    if (Msnapshot)
+    {
+      compute(node, *Msnapshot);
+      return;
+    }
+    std::shared_ptr<ConfigSnapshot const> snapshot(
+        McalexConfig->get_snapshot());
+    compute(node, *snapshot);
+  } // function CalexApplication<Ctype>::operator()
+
+  /*-------------------------------------------------------------------------*/
+  template <typename Ctype>
+  void CalexApplication<Ctype>::dispatch(opt::Grid<Ctype, TresultType>* grid,
+      ConfigSnapshot const& snapshot)
+  {
+    if (! MbatchDispatch || Mengine) { return; }
+
+    // collect the nodes of the grid
+    std::vector<opt::Node<Ctype, TresultType>*> nodes;
+    opt::Iterator<Ctype, TresultType> it(
+        grid->createIterator(opt::ForwardNodeIter));
+    for (it.first(); ! it.isDone(); it.next())
+    {
+      opt::Node<Ctype, TresultType>* node(
+          dynamic_cast<opt::Node<Ctype, TresultType>*>(*it));
+      // nodes of nested subgrids are dispatched with their own subgrid
+      if (node && node->getCoordinates().size() == snapshot.get_dimensions())
+      {
+        nodes.push_back(node);
+      }
+    }
+
+    // nodes of subgrids already were dispatched with the parent grid
     {
       boost::lock_guard<boost::mutex> lock(Mmutex);
-      McalexConfig->update<Ctype>(node->getCoordinates());
-
-      // write calex parameter file to disk
-#if BOOST_FILESYSTEM_VERSION == 2
-      // If V2 of the Boost filesystem library is in use construct calex
-      // parameter file name containing the thread ID.
-      std::ostringstream oss;
-      oss << "calex-" << boost::this_thread::get_id() << ".par";
-
-      param_path = oss.str();
-      std::ofstream ofs(param_path.string().c_str());
-#else
-      param_path = fs::unique_path("%%%%-%%%%-%%%%-%%%%.par");
-      std::ofstream ofs(param_path.c_str());
-#endif
-      ofs << *McalexConfig;
-      ofs.close();
+      auto last(std::remove_if(nodes.begin(), nodes.end(),
+            [this] (opt::Node<Ctype, TresultType>* node)
+            { return ! Mbatched.insert(node).second; }));
+      nodes.erase(last, nodes.end());
     }
 
-    // execute calex command
-    //std::string calex_command("calex "+param_path.string());
-    std::string calex_command("calex "+param_path.string()+" >/dev/null 2>&1");
-    system(calex_command.c_str());
-
-    // read calex result data of file *.out
-#if BOOST_FILESYSTEM_VERSION == 2
-    fs::path out_path(std::string(param_path.stem()+".out"));
-    std::ifstream ifs(out_path.string().c_str());
-#else
-    fs::path out_path(std::string(param_path.stem().string()+".out"));
-    std::ifstream ifs(out_path.c_str());
-#endif
-    TresultType calex_result;
-    if (ifs)
+    // write the calex parameter files of the whole batch in one pass
+    std::vector<CalexRun> runs;
+    runs.reserve(nodes.size());
+    for (auto cit(nodes.cbegin()); cit != nodes.cend(); ++cit)
     {
-      ifs >> calex_result;
-      
-      if (Mverbose) { std::cout << "Result: " << calex_result << std::endl; }
-      node->setResultData(calex_result);
-      ifs.close();
+      runs.push_back(prepare(*cit, snapshot));
+    }
 
-      node->setComputed();
+    // launch the batch by means of a pooled executor
+    std::shared_ptr<CalexExecutor> executor(Mexecutor);
+    if (! executor)
+    {
+      std::shared_ptr<ConcurrencyLimiter> limiter(
+          Mexternal.get_concurrencyLimiter());
+      executor.reset(new CalexExecutor(Mexternal.get_launcher(),
+            limiter ? limiter->get_slots() : availableCores()));
     }
-    // delete *.par and temporary calex files
-    CALEX_assert(fs::remove(param_path) && fs::remove(out_path),
-        "Error while removing current calex files");
+    for (auto cit(runs.cbegin()); cit != runs.cend(); ++cit)
+    {
+      executor->submit(*cit);
+    }
+    // an executor assigned to the application is driven by its owner
+    if (! Mexecutor) { executor->run(); }
+  } // function CalexApplication<Ctype>::dispatch
 
-  } // function CalexApplication<Ctype>::operator()
+  /*-------------------------------------------------------------------------*/
+  template <typename Ctype>
+  void CalexApplication<Ctype>::compute(opt::Node<Ctype, TresultType>* node,
+      ConfigSnapshot const& snapshot)
+  {
+    if (Mengine)
+    {
+      evaluate(node, snapshot);
+      return;
+    }
+
+    // node already dispatched within a batch
+    if (MbatchDispatch)
+    {
+      boost::lock_guard<boost::mutex> lock(Mmutex);
+      if (Mbatched.erase(node)) { return; }
+    }
+    CalexRun run(prepare(node, snapshot));
+
+    // hand off to the asynchronous executor
+    if (Mexecutor)
+    {
+      Mexecutor->submit(run);
+      return;
+    }
+    Mexternal.execute(run);
+  } // function CalexApplication<Ctype>::compute
+
+  /*-------------------------------------------------------------------------*/
+  template <typename Ctype>
+  CalexRun CalexApplication<Ctype>::prepare(
+      opt::Node<Ctype, TresultType>* node, ConfigSnapshot const& snapshot)
+  {
+    return Mexternal.prepare(snapshot, node->getCoordinates(),
+        [this, node] (TresultType const& result) { finish(node, result); });
+  } // function CalexApplication<Ctype>::prepare
+
+  /*-------------------------------------------------------------------------*/
+  template <typename Ctype>
+  void CalexApplication<Ctype>::evaluate(opt::Node<Ctype, TresultType>* node,
+      ConfigSnapshot const& snapshot)
+  {
+    double const start = monotonicTime();
+    TresultType calex_result(Mengine->evaluate(*McalexConfig, snapshot,
+          node->getCoordinates()));
+    Mexternal.get_runStatistics()->record(monotonicTime()-start, false);
+    if (calex_result.isComputed())
+    {
+      Mexternal.get_bestRms()->offer(calex_result.get_rms());
+    }
+    finish(node, calex_result);
+  } // function CalexApplication<Ctype>::evaluate
+
+  /*-------------------------------------------------------------------------*/
+  template <typename Ctype>
+  void CalexApplication<Ctype>::finish(opt::Node<Ctype, TresultType>* node,
+      TresultType const& result)
+  {
+    if (Mverbose) { std::cout << "Result: " << result << std::endl; }
+    if (Mstore) { Mstore->store(node->getCoordinates(), result); }
+    if (Mcube) { Mcube->store(node->getCoordinates(), result); }
+    node->setResultData(result);
+    if (result.isComputed()) { node->setComputed(); }
+  } // function CalexApplication<Ctype>::finish
 
   /*-------------------------------------------------------------------------*/
 
@@ -0,0 +1,58 @@
+/*! \file engine.cc
+ * \brief Implementation of forward engines evaluating calex configurations.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Implementation of forward engines evaluating calex configurations.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ *
+ * ============================================================================
+ */
+
+
+#include <cmath>
+#include <calexxx/engine.h>
+
+namespace calex
+{
+  /*=========================================================================*/
+  double mockRms(std::vector<double> const& values)
+  {
+    double sum = 1.;
+    for (auto cit(values.cbegin()); cit != values.cend(); ++cit)
+    {
+      sum += 1.-cos(*cit);
+    }
+    return 0.005*sum;
+  } // function mockRms
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+/* ----- END OF engine.cc  ----- */
@@ -0,0 +1,493 @@
+/*! \file engine.h
+ * \brief Declaration of forward engines evaluating calex configurations.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Declaration of forward engines evaluating calex configurations.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  Evaluate the configuration snapshot; write parameter
+ *                    files from its template.
+ * 17/10/2026   V0.3  Evaluate the snapshot of a subgrid.
+ * 17/10/2026   V0.4  Mock results refer to an interned calex::ResultSchema.
+ * 17/10/2026   V0.5  calex::ExternalEngine implements the calex pipeline
+ *                    of calex::CalexApplication including its refinements.
+ * 17/10/2026   V0.6  Runs without final system parameters are failed.
+ * 17/10/2026   V0.7  Kill and reap calex if watching it fails.
+ * 17/10/2026   V0.8  Parameter files outside scratch directories are
+ *                    removed by calex::ParameterFile.
+ * 17/10/2026   V0.9  Acquire the concurrency slot before creating the
+ *                    output channel.
+ *
+ * ============================================================================
+ */
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <csignal>
+#include <boost/filesystem.hpp>
+#include <boost/thread.hpp>
+#include <calexxx/calexconfig.h>
+#include <calexxx/snapshot.h>
+#include <calexxx/resultdata.h>
+#include <calexxx/launcher.h>
+#include <calexxx/scratchdir.h>
+#include <calexxx/outputchannel.h>
+#include <calexxx/pruning.h>
+#include <calexxx/watchdog.h>
+#include <calexxx/limiter.h>
+#include <calexxx/executor.h>
+#include <calexxx/placement.h>
+#include <calexxx/error.h>
+
+#ifndef _CALEX_ENGINE_H_
+#define _CALEX_ENGINE_H_
+
+namespace fs = boost::filesystem;
+
+namespace calex
+{
+  /*=========================================================================*/
+  /*!
+   * Interface of forward engines.
+   *
+   * A forward engine evaluates a calex configuration at the coordinates of a
+   * parameter space node and returns the result data. Engines are
+   * interchangeable at runtime (see CalexApplication::set_engine) such that
+   * e.g. an in-process implementation of the calex inversion can replace
+   * spawning the external calex program.
+   *
+   * Engines must be thread safe since a single engine is shared by all
+   * threads visiting the parameter space grid. Engines therefore evaluate
+   * the immutable snapshot of the configuration (see CalexConfig::freeze).
+   */
+  template <typename Ctype>
+  class ForwardEngine
+  {
+    public:
+      //! destructor
+      virtual ~ForwardEngine() { }
+      //! query function for the name of the engine
+      virtual std::string get_name() const = 0;
+      /*!
+       * evaluate a calex configuration
+       *
+       * \param config Frozen calex parameter file configuration.
+       * \param coordinates Coordinates of the parameter space node.
+       *
+       * \return result data
+       */
+      CalexResult evaluate(CalexConfig const& config,
+          std::vector<Ctype> const& coordinates)
+      { return evaluate(config, *config.get_snapshot(), coordinates); }
+      /*!
+       * evaluate a snapshot of a calex configuration
+       *
+       * \param config Frozen calex parameter file configuration.
+       * \param snapshot Snapshot of the configuration or of a subgrid (see
+       * CalexConfig::get_snapshot).
+       * \param coordinates Coordinates of the parameter space node.
+       *
+       * \return result data
+       */
+      virtual CalexResult evaluate(CalexConfig const& config,
+          ConfigSnapshot const& snapshot,
+          std::vector<Ctype> const& coordinates) = 0;
+
+  }; // class template ForwardEngine
+
+  /*=========================================================================*/
+  /*!
+   * Forward engine running the external calex program.
+   *
+   * A calex parameter file is written for every evaluation, calex is spawned
+   * by means of a calex::CalexLauncher and its output is parsed. The engine
+   * implements the calex pipeline of calex::CalexApplication, which
+   * delegates preparing and running calex to it. Refinements (scratch
+   * directories, output mode, pruning, run time limits, concurrency limiter
+   * and placement) are configured at the engine and apply to
+   * ExternalEngine::evaluate as well.
+   *
+   * Evaluating a node is split into ExternalEngine::prepare and
+   * ExternalEngine::execute such that the run may be handed off to a
+   * calex::CalexExecutor instead of being executed by the calling thread.
+   */
+  template <typename Ctype>
+  class ExternalEngine : public ForwardEngine<Ctype>
+  {
+    public:
+      //! handler receiving the result data of a calex run
+      typedef std::function<void (CalexResult const&)> Tcompletion;
+      /*!
+       * constructor
+       *
+       * \param program Name or path of the calex executable.
+       * \param mode output mode
+       */
+      ExternalEngine(std::string const& program="calex",
+          EoutputMode const mode=OutFile) : Mlauncher(program), Mmode(mode),
+        MbestRms(new BestRms), MrunStatistics(new RunStatistics)
+      { }
+      //! query function for the name of the engine
+      virtual std::string get_name() const { return "external"; }
+      using ForwardEngine<Ctype>::evaluate;
+      //! evaluate a snapshot of a calex configuration
+      virtual CalexResult evaluate(CalexConfig const& config,
+          ConfigSnapshot const& snapshot,
+          std::vector<Ctype> const& coordinates);
+      /*!
+       * create the scratch directory and write the calex parameter file
+       *
+       * \param snapshot Snapshot the parameter file is rendered from.
+       * \param coordinates Coordinates of the parameter space node.
+       * \param completion Handler called with the result data once the run
+       * completed. The calex files are removed afterwards.
+       *
+       * \return description of the calex run
+       */
+      CalexRun prepare(ConfigSnapshot const& snapshot,
+          std::vector<Ctype> const& coordinates,
+          Tcompletion const& completion) const;
+      /*!
+       * run calex synchronously within the calling thread
+       *
+       * If watching calex fails after it was spawned, calex is killed and
+       * the run is completed as calex::Failed.
+       *
+       * \param run description of the calex run created by
+       * ExternalEngine::prepare
+       */
+      void execute(CalexRun const& run) const;
+      //! query function for the calex process launcher
+      CalexLauncher& get_launcher() { return Mlauncher; }
+      //! query function for the calex process launcher
+      CalexLauncher const& get_launcher() const { return Mlauncher; }
+      /*!
+       * run calex in isolated scratch directories
+       *
+       * \param root Root directory scratch directories are created in. If
+       * empty calex is run in the current working directory.
+       */
+      void set_scratchRoot(std::string const& root) { MscratchRoot = root; }
+      //! select how calex output is transferred to the engine
+      void set_outputMode(EoutputMode const mode) { Mmode = mode; }
+      //! terminate hopeless calex runs early
+      void set_pruningPolicy(PruningPolicy const& policy)
+      { Mpruning = policy; }
+      //! query function for the best RMS found so far
+      std::shared_ptr<BestRms> get_bestRms() const { return MbestRms; }
+      //! share the best RMS found so far
+      void set_bestRms(std::shared_ptr<BestRms> best) { MbestRms = best; }
+      //! limit wall-clock and CPU time of every calex run
+      void set_runLimits(RunLimits const& limits) { Mlimits = limits; }
+      //! query function for the run time statistics
+      std::shared_ptr<RunStatistics> get_runStatistics() const
+      { return MrunStatistics; }
+      //! gate spawning calex by a concurrency limiter
+      void set_concurrencyLimiter(std::shared_ptr<ConcurrencyLimiter> limiter)
+      { Mlimiter = limiter; }
+      //! query function for the concurrency limiter
+      std::shared_ptr<ConcurrencyLimiter> get_concurrencyLimiter() const
+      { return Mlimiter; }
+      //! place calex processes on CPUs and NUMA nodes
+      void set_placement(std::shared_ptr<CpuPlacement> placement)
+      { Mplacement = placement; }
+
+    private:
+      //! launcher for calex processes
+      CalexLauncher Mlauncher;
+      //! output mode
+      EoutputMode Mmode;
+      //! root directory of scratch directories
+      std::string MscratchRoot;
+      //! pruning policy
+      PruningPolicy Mpruning;
+      //! best RMS found so far
+      std::shared_ptr<BestRms> MbestRms;
+      //! run time limits
+      RunLimits Mlimits;
+      //! run time statistics
+      std::shared_ptr<RunStatistics> MrunStatistics;
+      //! concurrency limiter
+      std::shared_ptr<ConcurrencyLimiter> Mlimiter;
+      //! CPU and NUMA placement
+      std::shared_ptr<CpuPlacement> Mplacement;
+
+  }; // class template ExternalEngine
+
+  /*=========================================================================*/
+  /*!
+   * Mock forward engine computing a deterministic RMS in-process.
+   *
+   * The RMS is computed from the system parameter values of the
+   * configuration by calex::mockRms. The engine serves to benchmark the grid
+   * pipeline without the calex program and without spawning processes.
+   */
+  template <typename Ctype>
+  class MockEngine : public ForwardEngine<Ctype>
+  {
+    public:
+      //! query function for the name of the engine
+      virtual std::string get_name() const { return "mock"; }
+      using ForwardEngine<Ctype>::evaluate;
+      //! evaluate a snapshot of a calex configuration
+      virtual CalexResult evaluate(CalexConfig const& config,
+          ConfigSnapshot const& snapshot,
+          std::vector<Ctype> const& coordinates);
+
+  }; // class template MockEngine
+
+  /*=========================================================================*/
+  /*!
+   * Deterministic mock RMS of model parameter values.
+   *
+   * \f$ RMS = 0.005 \left(1 + \sum_i (1-\cos v_i)\right) \f$
+   *
+   * \param values system parameter values (see ConfigSnapshot::values)
+   */
+  double mockRms(std::vector<double> const& values);
+
+  /*!
+   * Create a forward engine by name.
+   *
+   * \param name \c external or \c mock
+   * \param program Name or path of the calex executable (\c external only).
+   *
+   * \return forward engine
+   */
+  template <typename Ctype>
+  std::shared_ptr<ForwardEngine<Ctype>> createEngine(std::string const& name,
+      std::string const& program="calex");
+
+  /*=========================================================================*/
+  template <typename Ctype>
+  CalexResult ExternalEngine<Ctype>::evaluate(CalexConfig const& config,
+      ConfigSnapshot const& snapshot, std::vector<Ctype> const& coordinates)
+  {
+    CalexResult result;
+    execute(prepare(snapshot, coordinates,
+          [&result] (CalexResult const& completed) { result = completed; }));
+    return result;
+  } // function ExternalEngine<Ctype>::evaluate
+
+  /*-------------------------------------------------------------------------*/
+  template <typename Ctype>
+  CalexRun ExternalEngine<Ctype>::prepare(ConfigSnapshot const& snapshot,
+      std::vector<Ctype> const& coordinates,
+      Tcompletion const& completion) const
+  {
+    // calex parameter file path relative to the working directory of calex
+    fs::path param_path;
+    std::shared_ptr<ScratchDirectory> scratch;
+    std::shared_ptr<ParameterFile> param_file;
+    CalexRun run;
+    std::string const& infile(snapshot.get_infile());
+    std::string const& outfile(snapshot.get_outfile());
+    if (! MscratchRoot.empty())
+    {
+      std::string infile_link(infile.substr(infile.find_last_of('/')+1));
+      std::string outfile_link(outfile.substr(outfile.find_last_of('/')+1));
+      CALEX_assert(infile_link != outfile_link,
+          "Signal files must have distinct filenames.");
+      scratch.reset(new ScratchDirectory(MscratchRoot));
+      scratch->link(infile, infile_link);
+      scratch->link(outfile, outfile_link);
+      run.Moptions.Mworkdir = scratch->get_path();
+      param_path = "calex.par";
+      snapshot.writeFile(run.Moptions.Mworkdir+"/"+param_path.string(),
+          coordinates, infile_link, outfile_link);
+    }
+    else
+    {
+#if BOOST_FILESYSTEM_VERSION == 2
+      // If V2 of the Boost filesystem library is in use construct calex
+      // parameter file name containing the thread ID and a sequence number
+      // since a single thread prepares all runs of a batch.
+      param_file.reset(new ParameterFile);
+#else
+      param_file.reset(new ParameterFile(
+            fs::unique_path("%%%%-%%%%-%%%%-%%%%.par").string()));
+#endif
+      param_path = param_file->get_path();
+      snapshot.writeFile(param_path.string(), coordinates, infile, outfile);
+    }
+
+    // calex output file (or link) path relative to the working directory of
+    // the caller
+#if BOOST_FILESYSTEM_VERSION == 2
+    fs::path out_path(std::string(param_path.stem()+".out"));
+#else
+    fs::path out_path(std::string(param_path.stem().string()+".out"));
+#endif
+    if (scratch) { out_path = fs::path(run.Moptions.Mworkdir) / out_path; }
+
+    run.Mparam = param_path.string();
+    run.MoutPath = out_path.string();
+    run.Mmode = Mmode;
+    run.Mlimits = Mlimits;
+    run.Mpruning = Mpruning;
+    run.MbestRms = MbestRms;
+    run.MrunStatistics = MrunStatistics;
+    run.Mplacement = Mplacement;
+    // the run owns its files; they are removed if it is abandoned
+    run.Mcompletion = [completion, scratch, param_file]
+      (CalexResult const& result)
+      {
+        if (completion) { completion(result); }
+        // delete *.par and temporary calex files
+        if (scratch) { scratch->remove(); }
+        else { param_file->remove(); }
+      };
+    return run;
+  } // function ExternalEngine<Ctype>::prepare
+
+  /*-------------------------------------------------------------------------*/
+  template <typename Ctype>
+  void ExternalEngine<Ctype>::execute(CalexRun const& run) const
+  {
+    CALEX_assert(run.MbestRms && run.MrunStatistics,
+        "Calex run not prepared.");
+    // execute calex command
+    SpawnOptions options(run.Moptions);
+    // threads waiting for admission do not hold any descriptors
+    std::unique_ptr<ConcurrencyLimiter::Slot> slot;
+    if (Mlimiter) { slot.reset(new ConcurrencyLimiter::Slot(*Mlimiter)); }
+    OutputChannel channel(run.Mmode);
+    channel.prepare(run.MoutPath, options);
+    if (run.Mplacement) { run.Mplacement->assign(options); }
+    pid_t pid = Mlauncher.spawn(run.Mparam, options);
+    IterationMonitor monitor(run.Mpruning, *run.MbestRms);
+    std::unique_ptr<Watchdog> watchdog;
+    struct rusage usage;
+    int status;
+    try
+    {
+      channel.spawned();
+      if (run.Mlimits.McpuTime > 0)
+      {
+        limitCpuTime(pid, run.Mlimits.McpuTime);
+      }
+
+      // watch calex while running
+      watchdog.reset(new Watchdog(pid, run.Mlimits.MwallTime));
+      while (watchdog->waitFor(channel.get_fd()) && channel.drainSome())
+      {
+        if (run.Mpruning.isActive() && monitor.feed(channel.get_buffer()))
+        {
+          break;
+        }
+      }
+      // calex may close its output before terminating
+      if (! monitor.prune()) { watchdog->waitFor(-1); }
+      if (watchdog->expired() || monitor.prune()) { kill(pid, SIGKILL); }
+      else { channel.drain(); }
+      status = Mlauncher.wait(pid, &usage);
+    }
+    catch (...)
+    {
+      // neither leave calex running nor skip the completion of the run
+      kill(pid, SIGKILL);
+      try { Mlauncher.wait(pid); } catch (...) { }
+      channel.cleanup();
+      CalexResult calex_result;
+      calex_result.set_failed();
+      if (run.Mcompletion) { run.Mcompletion(calex_result); }
+      return;
+    }
+    double const seconds = watchdog->elapsed();
+    slot.reset();
+    if (run.Mplacement) { run.Mplacement->log(pid, options, seconds); }
+
+    // read calex result data
+    CalexResult calex_result;
+    bool const parsed = exitedSuccessfully(status) &&
+      channel.read(calex_result);
+    channel.cleanup();
+    calex_result.set_exitStatus(status);
+    // calex exited normally without reporting final system parameters
+    if (! parsed) { calex_result.set_failed(); }
+    if (monitor.prune())
+    {
+      calex_result.set_pruned(monitor.get_iter(), monitor.get_rms());
+    } else
+    if (watchdog->expired() ||
+        exceededCpuTime(status, usage, run.Mlimits.McpuTime))
+    {
+      calex_result.set_timedOut();
+    } else
+    if (calex_result.isComputed())
+    {
+      run.MbestRms->offer(calex_result.get_rms());
+    }
+    run.MrunStatistics->record(seconds,
+        TimedOut == calex_result.get_status());
+
+    if (run.Mcompletion) { run.Mcompletion(calex_result); }
+  } // function ExternalEngine<Ctype>::execute
+
+  /*-------------------------------------------------------------------------*/
+  template <typename Ctype>
+  CalexResult MockEngine<Ctype>::evaluate(CalexConfig const& config,
+      ConfigSnapshot const& snapshot, std::vector<Ctype> const& coordinates)
+  {
+    std::vector<std::string> names;
+    std::vector<double> values(snapshot.values(coordinates, &names));
+    if (values.empty())
+    {
+      return CalexResult(config.get_maxit(), mockRms(values), 0, 0);
+    }
+    return CalexResult(config.get_maxit(), mockRms(values),
+        ResultSchema::intern(names), &values[0]);
+  } // function MockEngine<Ctype>::evaluate
+
+  /*-------------------------------------------------------------------------*/
+  template <typename Ctype>
+  std::shared_ptr<ForwardEngine<Ctype>> createEngine(std::string const& name,
+      std::string const& program)
+  {
+    if ("external" == name)
+    {
+      return std::shared_ptr<ForwardEngine<Ctype>>(
+          new ExternalEngine<Ctype>(program));
+    }
+    if ("mock" == name)
+    {
+      return std::shared_ptr<ForwardEngine<Ctype>>(new MockEngine<Ctype>);
+    }
+    CALEX_abort("Unknown forward engine.");
+  } // function createEngine
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+#endif // include guard
+
+/* ----- END OF engine.h  ----- */
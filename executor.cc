@@ -0,0 +1,411 @@
+/*! \file executor.cc
+ * \brief Implementation of an event-driven executor for calex runs.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Implementation of an event-driven executor for calex runs.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  Move results into their futures.
+ * 17/10/2026   V0.3  Runs without final system parameters are failed.
+ * 17/10/2026   V0.4  Runs failing to launch are completed as failed.
+ *
+ * ============================================================================
+ */
+
+
+#include <cmath>
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <exception>
+#include <utility>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <calexxx/executor.h>
+#include <calexxx/error.h>
+
+namespace calex
+{
+  namespace
+  {
+    //! maximum number of events processed at once
+    const int CALEX_EXECUTOR_EVENTS = 64;
+
+    //! register a descriptor for input events
+    void watch(int const epoll, int const fd)
+    {
+      struct epoll_event event;
+      event.events = EPOLLIN;
+      event.data.fd = fd;
+      CALEX_assert(0 == epoll_ctl(epoll, EPOLL_CTL_ADD, fd, &event),
+          "Error while registering descriptor.");
+    }
+
+  } // namespace (unnamed)
+
+  /*=========================================================================*/
+  struct CalexExecutor::Flight
+  {
+    //! constructor
+    Flight(CalexRun const& run,
+        std::shared_ptr<std::promise<CalexResult>> promise) : Mrun(run),
+      Mpromise(promise), Moptions(run.Moptions), Mpid(-1), Mpidfd(-1),
+      Mchannel(run.Mmode),
+      Mmonitor(run.Mpruning, run.MbestRms ? *run.MbestRms : Mnone),
+      Mstart(monotonicTime()), MtimedOut(false)
+    { }
+    //! description of the run
+    CalexRun Mrun;
+    //! promise providing the result data
+    std::shared_ptr<std::promise<CalexResult>> Mpromise;
+    //! spawn options
+    SpawnOptions Moptions;
+    //! process id of calex
+    pid_t Mpid;
+    //! process file descriptor
+    int Mpidfd;
+    //! output channel
+    OutputChannel Mchannel;
+    //! best RMS used if the run does not provide one
+    BestRms Mnone;
+    //! iteration monitor
+    IterationMonitor Mmonitor;
+    //! start time (monotonic clock)
+    double Mstart;
+    //! flag if the wall-clock limit was exceeded
+    bool MtimedOut;
+  }; // struct CalexExecutor::Flight
+
+  /*=========================================================================*/
+  CalexExecutor::CalexExecutor(CalexLauncher const& launcher,
+      unsigned int const max_in_flight) : Mlauncher(launcher),
+    MmaxInFlight(max_in_flight)
+  {
+    CALEX_assert(0 < MmaxInFlight,
+        "Number of runs in flight must be positive.");
+    Mepoll = epoll_create1(EPOLL_CLOEXEC);
+    CALEX_assert(-1 != Mepoll, "Error while creating epoll descriptor.");
+    Mwakeup = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    CALEX_assert(-1 != Mwakeup, "Error while creating eventfd.");
+    watch(Mepoll, Mwakeup);
+  }
+
+  /*-------------------------------------------------------------------------*/
+  CalexExecutor::~CalexExecutor()
+  {
+    for (auto it(Mflights.begin()); it != Mflights.end(); ++it)
+    {
+      Flight* flight = it->second;
+      kill(flight->Mpid, SIGKILL);
+      // destructors must not throw
+      try { Mlauncher.wait(flight->Mpid); } catch (...) { }
+      flight->Mchannel.cleanup();
+      close(flight->Mpidfd);
+      delete flight;
+    }
+    close(Mwakeup);
+    close(Mepoll);
+  }
+
+  /*-------------------------------------------------------------------------*/
+  std::shared_future<CalexResult> CalexExecutor::submit(CalexRun const& run)
+  {
+    std::shared_ptr<std::promise<CalexResult>> promise(
+        new std::promise<CalexResult>);
+    std::shared_future<CalexResult> future(promise->get_future());
+    {
+      boost::lock_guard<boost::mutex> lock(Mmutex);
+      Mqueue.push_back(std::make_pair(run, promise));
+    }
+    uint64_t one = 1;
+    CALEX_assert(sizeof(one) == write(Mwakeup, &one, sizeof(one)),
+        "Error while waking up executor.");
+    return future;
+  } // function CalexExecutor::submit
+
+  /*-------------------------------------------------------------------------*/
+  size_t CalexExecutor::get_queued() const
+  {
+    boost::lock_guard<boost::mutex> lock(Mmutex);
+    return Mqueue.size();
+  }
+
+  /*-------------------------------------------------------------------------*/
+  bool CalexExecutor::runOnce(int const timeout)
+  {
+    spawnQueued();
+    if (Mflights.empty() && 0 == get_queued()) { return false; }
+
+    struct epoll_event events[CALEX_EXECUTOR_EVENTS];
+    int n;
+    do
+    {
+      n = epoll_wait(Mepoll, events, CALEX_EXECUTOR_EVENTS,
+          nextTimeout(timeout));
+    } while (-1 == n && EINTR == errno);
+    CALEX_assert(-1 != n, "Error while waiting for events.");
+
+    // handle output first such that it is complete on termination
+    for (int i = 0; i < n; ++i)
+    {
+      auto it(Mpipes.find(events[i].data.fd));
+      if (it != Mpipes.end()) { handleOutput(*it->second); }
+    }
+    for (int i = 0; i < n; ++i)
+    {
+      int fd = events[i].data.fd;
+      if (Mwakeup == fd)
+      {
+        uint64_t count;
+        while (sizeof(count) == read(Mwakeup, &count, sizeof(count))) { }
+        continue;
+      }
+      auto it(Mflights.find(fd));
+      if (it != Mflights.end()) { complete(it->second); }
+    }
+    enforceDeadlines();
+    spawnQueued();
+    return ! Mflights.empty() || 0 != get_queued();
+  } // function CalexExecutor::runOnce
+
+  /*-------------------------------------------------------------------------*/
+  void CalexExecutor::run()
+  {
+    while (runOnce()) { }
+  }
+
+  /*-------------------------------------------------------------------------*/
+  void CalexExecutor::spawnQueued()
+  {
+    while (Mflights.size() < MmaxInFlight)
+    {
+      Flight* flight;
+      {
+        boost::lock_guard<boost::mutex> lock(Mmutex);
+        if (Mqueue.empty()) { return; }
+        flight = new Flight(Mqueue.front().first, Mqueue.front().second);
+        Mqueue.pop_front();
+      }
+      try
+      {
+        SpawnOptions& options(flight->Moptions);
+        if (flight->Mrun.Mplacement)
+        {
+          flight->Mrun.Mplacement->assign(options);
+        }
+        flight->Mchannel.prepare(flight->Mrun.MoutPath, options);
+        flight->Mpid = Mlauncher.spawn(flight->Mrun.Mparam, options);
+        flight->Mchannel.spawned();
+        if (flight->Mrun.Mlimits.McpuTime > 0)
+        {
+          limitCpuTime(flight->Mpid, flight->Mrun.Mlimits.McpuTime);
+        }
+        flight->Mpidfd = syscall(SYS_pidfd_open, flight->Mpid, 0);
+        CALEX_assert(-1 != flight->Mpidfd,
+            "Error while opening process file descriptor.");
+        watch(Mepoll, flight->Mpidfd);
+        int fd = flight->Mchannel.get_fd();
+        if (-1 != fd)
+        {
+          CALEX_assert(0 == fcntl(fd, F_SETFL, O_NONBLOCK),
+              "Error while configuring pipe.");
+          watch(Mepoll, fd);
+          Mpipes[fd] = flight;
+        }
+      }
+      catch (...)
+      {
+        abandon(flight);
+        continue;
+      }
+      Mflights[flight->Mpidfd] = flight;
+    }
+  } // function CalexExecutor::spawnQueued
+
+  /*-------------------------------------------------------------------------*/
+  void CalexExecutor::handleOutput(Flight& flight)
+  {
+    int fd = flight.Mchannel.get_fd();
+    bool eof = ! flight.Mchannel.drainSome();
+    if (flight.Mrun.Mpruning.isActive() && ! flight.Mmonitor.prune() &&
+        flight.Mmonitor.feed(flight.Mchannel.get_buffer()))
+    {
+      kill(flight.Mpid, SIGKILL);
+    }
+    if (eof)
+    {
+      epoll_ctl(Mepoll, EPOLL_CTL_DEL, fd, 0);
+      Mpipes.erase(fd);
+    }
+  } // function CalexExecutor::handleOutput
+
+  /*-------------------------------------------------------------------------*/
+  void CalexExecutor::complete(Flight* flight)
+  {
+    Mflights.erase(flight->Mpidfd);
+    epoll_ctl(Mepoll, EPOLL_CTL_DEL, flight->Mpidfd, 0);
+    close(flight->Mpidfd);
+    int fd = flight->Mchannel.get_fd();
+    if (Mpipes.count(fd))
+    {
+      // collect output still buffered in the pipe
+      if (! flight->Mmonitor.prune() && ! flight->MtimedOut)
+      {
+        fcntl(fd, F_SETFL, 0);
+        flight->Mchannel.drain();
+      }
+      epoll_ctl(Mepoll, EPOLL_CTL_DEL, fd, 0);
+      Mpipes.erase(fd);
+    }
+
+    CalexResult result;
+    try
+    {
+      struct rusage usage;
+      int status = Mlauncher.wait(flight->Mpid, &usage);
+      double const seconds = monotonicTime()-flight->Mstart;
+      bool const parsed = exitedSuccessfully(status) &&
+        flight->Mchannel.read(result);
+      flight->Mchannel.cleanup();
+      result.set_exitStatus(status);
+      // calex exited normally without reporting final system parameters
+      if (! parsed) { result.set_failed(); }
+      CalexRun const& run(flight->Mrun);
+      if (flight->Mmonitor.prune())
+      {
+        result.set_pruned(flight->Mmonitor.get_iter(),
+            flight->Mmonitor.get_rms());
+      } else
+      if (flight->MtimedOut ||
+          exceededCpuTime(status, usage, run.Mlimits.McpuTime))
+      {
+        result.set_timedOut();
+      } else
+      if (result.isComputed() && run.MbestRms)
+      {
+        run.MbestRms->offer(result.get_rms());
+      }
+      if (run.Mplacement)
+      {
+        run.Mplacement->log(flight->Mpid, flight->Moptions, seconds);
+      }
+      if (run.MrunStatistics)
+      {
+        run.MrunStatistics->record(seconds, TimedOut == result.get_status());
+      }
+      if (run.Mcompletion) { run.Mcompletion(result); }
+    }
+    catch (...)
+    {
+      flight->Mpromise->set_exception(std::current_exception());
+      delete flight;
+      throw;
+    }
+    flight->Mpromise->set_value(std::move(result));
+    delete flight;
+  } // function CalexExecutor::complete
+
+  /*-------------------------------------------------------------------------*/
+  void CalexExecutor::abandon(Flight* flight)
+  {
+    // calex may have been spawned before the failure
+    if (-1 != flight->Mpid)
+    {
+      kill(flight->Mpid, SIGKILL);
+      try { Mlauncher.wait(flight->Mpid); } catch (...) { }
+    }
+    int fd = flight->Mchannel.get_fd();
+    if (Mpipes.count(fd))
+    {
+      epoll_ctl(Mepoll, EPOLL_CTL_DEL, fd, 0);
+      Mpipes.erase(fd);
+    }
+    if (-1 != flight->Mpidfd)
+    {
+      epoll_ctl(Mepoll, EPOLL_CTL_DEL, flight->Mpidfd, 0);
+      close(flight->Mpidfd);
+    }
+    flight->Mchannel.cleanup();
+
+    CalexResult result;
+    result.set_failed();
+    try
+    {
+      if (flight->Mrun.Mcompletion) { flight->Mrun.Mcompletion(result); }
+    }
+    catch (...)
+    {
+      flight->Mpromise->set_exception(std::current_exception());
+      delete flight;
+      return;
+    }
+    flight->Mpromise->set_value(std::move(result));
+    delete flight;
+  } // function CalexExecutor::abandon
+
+  /*-------------------------------------------------------------------------*/
+  void CalexExecutor::enforceDeadlines()
+  {
+    double now = monotonicTime();
+    for (auto it(Mflights.begin()); it != Mflights.end(); ++it)
+    {
+      Flight* flight = it->second;
+      double limit = flight->Mrun.Mlimits.MwallTime;
+      if (limit > 0. && ! flight->MtimedOut && now-flight->Mstart >= limit)
+      {
+        flight->MtimedOut = true;
+        kill(flight->Mpid, SIGKILL);
+      }
+    }
+  } // function CalexExecutor::enforceDeadlines
+
+  /*-------------------------------------------------------------------------*/
+  int CalexExecutor::nextTimeout(int const timeout) const
+  {
+    double now = monotonicTime();
+    int retval = timeout;
+    for (auto it(Mflights.begin()); it != Mflights.end(); ++it)
+    {
+      Flight const* flight = it->second;
+      double limit = flight->Mrun.Mlimits.MwallTime;
+      if (limit <= 0. || flight->MtimedOut) { continue; }
+      double remaining = flight->Mstart+limit-now;
+      int ms = remaining > 0. ? static_cast<int>(std::ceil(remaining*1e3)) : 0;
+      if (-1 == retval || ms < retval) { retval = ms; }
+    }
+    return retval;
+  } // function CalexExecutor::nextTimeout
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+/* ----- END OF executor.cc  ----- */
@@ -0,0 +1,205 @@
+/*! \file executor.h
+ * \brief Declaration of an event-driven executor for calex runs.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Declaration of an event-driven executor for calex runs.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  Runs failing to launch are completed as failed.
+ *
+ * ============================================================================
+ */
+
+
+#include <string>
+#include <deque>
+#include <map>
+#include <memory>
+#include <functional>
+#include <future>
+#include <sys/types.h>
+#include <boost/thread.hpp>
+#include <calexxx/launcher.h>
+#include <calexxx/outputchannel.h>
+#include <calexxx/pruning.h>
+#include <calexxx/watchdog.h>
+#include <calexxx/placement.h>
+#include <calexxx/resultdata.h>
+#include <calexxx/error.h>
+
+#ifndef _CALEX_EXECUTOR_H_
+#define _CALEX_EXECUTOR_H_
+
+namespace calex
+{
+  /*=========================================================================*/
+  /*!
+   * Description of a single calex run submitted to a calex::CalexExecutor.
+   */
+  struct CalexRun
+  {
+    //! constructor
+    CalexRun() : Mmode(OutFile) { }
+    //! path of the calex parameter file relative to the working directory
+    std::string Mparam;
+    //! path of the calex \c *.out file relative to the caller
+    std::string MoutPath;
+    //! spawn options (e.g. working directory)
+    SpawnOptions Moptions;
+    //! output mode
+    EoutputMode Mmode;
+    //! run time limits
+    RunLimits Mlimits;
+    //! pruning policy (requires calex::StdoutPipe)
+    PruningPolicy Mpruning;
+    //! best RMS found so far (optional)
+    std::shared_ptr<BestRms> MbestRms;
+    //! run time statistics the run is recorded in (optional)
+    std::shared_ptr<RunStatistics> MrunStatistics;
+    //! CPU and NUMA placement (optional)
+    std::shared_ptr<CpuPlacement> Mplacement;
+    /*!
+     * completion handler (optional) called by the thread driving the
+     * executor
+     */
+    std::function<void (CalexResult const&)> Mcompletion;
+
+  }; // struct CalexRun
+
+  /*=========================================================================*/
+  /*!
+   * Event-driven executor for calex runs.
+   *
+   * Blocking in \c waitpid every calex process in flight occupies a thread.
+   * The executor instead keeps up to a configurable number of calex
+   * processes in flight and is driven by a single thread. Process
+   * termination is watched by means of process file descriptors (\c
+   * pidfd_open), calex output pipes (calex::StdoutPipe) and a wakeup \c
+   * eventfd are multiplexed by \c epoll. Wall-clock limits are enforced by
+   * the \c epoll timeout.
+   *
+   * Runs may be submitted from any thread. On completion the run's
+   * completion handler is called and the future returned by
+   * CalexExecutor::submit is made ready:
+   * \code
+   * calex::CalexExecutor executor(launcher, 64);
+   * std::shared_future<calex::CalexResult> result(executor.submit(run));
+   * executor.run();
+   * std::cout << result.get();
+   * \endcode
+   *
+   * The result status is determined as in calex::CalexApplication, i.e.
+   * pruned and timed out runs are reported as calex::Pruned and
+   * calex::TimedOut, respectively. A run failing to launch is completed as
+   * calex::Failed without affecting the remaining runs.
+   */
+  class CalexExecutor
+  {
+    public:
+      /*!
+       * constructor
+       *
+       * \param launcher Launcher used to spawn calex. The launcher must
+       * outlive the executor.
+       * \param max_in_flight maximum number of calex processes in flight
+       */
+      CalexExecutor(CalexLauncher const& launcher,
+          unsigned int const max_in_flight);
+      //! destructor - kills calex processes still in flight
+      ~CalexExecutor();
+      /*!
+       * submit a calex run (thread safe)
+       *
+       * \param run description of the calex run
+       *
+       * \return future providing the result data of the run
+       */
+      std::shared_future<CalexResult> submit(CalexRun const& run);
+      /*!
+       * spawn queued runs and process events once
+       *
+       * \param timeout Maximum time in milliseconds to wait for events. -1
+       * means infinite.
+       *
+       * \return false if neither runs are queued nor in flight
+       */
+      bool runOnce(int const timeout=-1);
+      //! drive the executor until all submitted runs completed
+      void run();
+      //! query function for the number of calex processes in flight
+      size_t get_inFlight() const { return Mflights.size(); }
+      //! query function for the number of runs not spawned yet
+      size_t get_queued() const;
+
+    private:
+      //! state of a calex process in flight
+      struct Flight;
+      //! copying is not allowed
+      CalexExecutor(CalexExecutor const&);
+      CalexExecutor& operator=(CalexExecutor const&);
+      //! spawn queued runs as long as slots are available
+      void spawnQueued();
+      //! handle available calex output
+      void handleOutput(Flight& flight);
+      //! complete a terminated calex process
+      void complete(Flight* flight);
+      //! kill and reap calex of a run failing to launch; complete as failed
+      void abandon(Flight* flight);
+      //! kill calex processes exceeding their wall-clock limit
+      void enforceDeadlines();
+      //! epoll timeout in milliseconds according to the closest deadline
+      int nextTimeout(int const timeout) const;
+
+    private:
+      //! launcher used to spawn calex
+      CalexLauncher const& Mlauncher;
+      //! maximum number of calex processes in flight
+      unsigned int const MmaxInFlight;
+      //! epoll descriptor
+      int Mepoll;
+      //! eventfd waking up the driving thread on submission
+      int Mwakeup;
+      //! runs not spawned yet
+      std::deque<std::pair<CalexRun,
+        std::shared_ptr<std::promise<CalexResult>>>> Mqueue;
+      //! calex processes in flight by process file descriptor
+      std::map<int, Flight*> Mflights;
+      //! calex processes in flight by descriptor of their output pipe
+      std::map<int, Flight*> Mpipes;
+      //! mutual exclusion variable protecting the queue
+      mutable boost::mutex Mmutex;
+
+  }; // class CalexExecutor
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+#endif // include guard
+
+/* ----- END OF executor.h  ----- */
@@ -0,0 +1,390 @@
+/*! \file flatconfig.cc
+ * \brief Implementation of a compact representation of calex configurations.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Implementation of a compact representation of calex configurations.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  Strings within the arena; convert back into
+ *                    independent grid system parameters.
+ * 17/10/2026   V0.3  Format system parameter lines independently of the C
+ *                    locale.
+ *
+ * ============================================================================
+ */
+
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <calexxx/flatconfig.h>
+#include <calexxx/error.h>
+
+namespace calex
+{
+  namespace
+  {
+    //! alignment of memory handed out by the arena
+    const size_t CALEX_ARENA_ALIGNMENT = 16;
+  } // namespace (unnamed)
+
+  /*=========================================================================*/
+  ParameterArena::ParameterArena(size_t const block_size) :
+    MblockSize(block_size), Moffset(0), MlastSize(0), Mused(0), Mreserved(0)
+  { 
+    CALEX_assert(MblockSize > 0, "Illegal arena block size.");
+  }
+
+  /*-------------------------------------------------------------------------*/
+  ParameterArena::~ParameterArena()
+  {
+    clear();
+  }
+
+  /*-------------------------------------------------------------------------*/
+  void* ParameterArena::allocate(size_t const bytes)
+  {
+    size_t const size = (bytes+CALEX_ARENA_ALIGNMENT-1) &
+      ~(CALEX_ARENA_ALIGNMENT-1);
+    if (Mblocks.empty() || Moffset+size > MlastSize)
+    {
+      // oversized requests are served by a block of their own
+      size_t const block = size > MblockSize ? size : MblockSize;
+      char* mem = static_cast<char*>(malloc(block));
+      CALEX_assert(0 != mem, "Error while allocating arena block.");
+      Mblocks.push_back(mem);
+      Moffset = 0;
+      MlastSize = block;
+      Mreserved += block;
+    }
+    void* ptr = Mblocks.back()+Moffset;
+    Moffset += size;
+    Mused += size;
+    return ptr;
+  } // function ParameterArena::allocate
+
+  /*-------------------------------------------------------------------------*/
+  void ParameterArena::clear()
+  {
+    for (auto it(Mblocks.begin()); it != Mblocks.end(); ++it) { free(*it); }
+    Mblocks.clear();
+    Moffset = 0;
+    MlastSize = 0;
+    Mused = 0;
+    Mreserved = 0;
+  } // function ParameterArena::clear
+
+  /*=========================================================================*/
+  FlatConfig::FlatConfig(CalexConfig const& config, ParameterArena& arena) :
+    Malias(config.Malias), Mm0(config.Mm0),
+    Mmaxit(config.Mmaxit), Mqac(config.Mqac), Mfinac(config.Mfinac),
+    Mns1(config.Mns1), Mns2(config.Mns2), Msize(4),
+    Mextra(config.MsystemParameters.size()),
+    Msubsystems(config.MsubSystems.size()), Mdimensions(0)
+  {
+    CALEX_assert(config.Mamp && config.Mdel && config.Msub && config.Mtil,
+        "System parameters not assigned.");
+    std::ostringstream oss;
+    config.writeControlParameters(oss);
+    std::string const control(oss.str());
+
+    // the strings are stored NUL terminated within a single text block
+    std::string const* strings[] = {&config.Mcomment, &config.Minfile,
+      &config.Moutfile, &control};
+    uint32_t* offsets[] = {&Mcomment, &Minfile, &Moutfile, &Mcontrol};
+    MtextSize = 0;
+    for (size_t i = 0; i < 4; ++i)
+    {
+      *offsets[i] = MtextSize;
+      MtextSize += strings[i]->size()+1;
+    }
+    Mtext = arena.allocate<char>(MtextSize);
+    for (size_t i = 0; i < 4; ++i)
+    {
+      memcpy(Mtext+*offsets[i], strings[i]->c_str(), strings[i]->size()+1);
+    }
+
+    auto const& subsystems(config.MsubSystems);
+    Msize += Mextra;
+    for (auto cit(subsystems.cbegin()); cit != subsystems.cend(); ++cit)
+    {
+      Msize += (*cit)->get_order();
+    }
+    allocate(arena);
+
+    std::shared_ptr<Tprototypes> prototypes(new Tprototypes);
+    unsigned int idx = 0;
+    store(idx++, config.Mamp, *prototypes);
+    store(idx++, config.Mdel, *prototypes);
+    store(idx++, config.Msub, *prototypes);
+    store(idx++, config.Mtil, *prototypes);
+    auto const& params(config.MsystemParameters);
+    for (auto cit(params.cbegin()); cit != params.cend(); ++cit)
+    {
+      store(idx++, *cit, *prototypes);
+    }
+    for (unsigned int k = 0; k < Msubsystems; ++k)
+    {
+      Mtypes[k] = subsystems[k]->get_type();
+      Morders[k] = subsystems[k]->get_order();
+      store(idx++, subsystems[k]->get_per(), *prototypes);
+      if (2 == Morders[k])
+      {
+        store(idx++, subsystems[k]->get_dmp(), *prototypes);
+      }
+    }
+    MgridParameters = prototypes;
+
+    // every coordinate must be assigned to exactly one grid system parameter
+    Mslots = arena.allocate<uint32_t>(Mdimensions);
+    std::vector<bool> assigned(Mdimensions, false);
+    for (idx = 0; idx < Msize; ++idx)
+    {
+      int32_t const id = Mcoordinates[idx];
+      if (id < 0) { continue; }
+      if (static_cast<unsigned int>(id) >= Mdimensions || assigned[id])
+      {
+        // not synchronized yet - updating is not possible
+        Mslots = 0;
+        break;
+      }
+      assigned[id] = true;
+      Mslots[id] = idx;
+    }
+  }
+
+  /*-------------------------------------------------------------------------*/
+  FlatConfig::FlatConfig(FlatConfig const& other, ParameterArena& arena) :
+    MtextSize(other.MtextSize), Mcomment(other.Mcomment),
+    Minfile(other.Minfile), Moutfile(other.Moutfile),
+    Mcontrol(other.Mcontrol), Malias(other.Malias), Mm0(other.Mm0),
+    Mmaxit(other.Mmaxit), Mqac(other.Mqac), Mfinac(other.Mfinac),
+    Mns1(other.Mns1), Mns2(other.Mns2), Msize(other.Msize),
+    Mextra(other.Mextra), Msubsystems(other.Msubsystems),
+    Mdimensions(other.Mdimensions), MgridParameters(other.MgridParameters)
+  {
+    allocate(arena);
+    Mtext = arena.allocate<char>(MtextSize);
+    memcpy(Mtext, other.Mtext, MtextSize);
+    memcpy(Mnames, other.Mnames, Msize*sizeof(uint32_t));
+    memcpy(Mvalues, other.Mvalues, Msize*sizeof(double));
+    memcpy(Muncertainties, other.Muncertainties, Msize*sizeof(double));
+    memcpy(Mgrid, other.Mgrid, Msize);
+    memcpy(Mcoordinates, other.Mcoordinates, Msize*sizeof(int32_t));
+    memcpy(Mtypes, other.Mtypes, Msubsystems);
+    memcpy(Morders, other.Morders, Msubsystems);
+    Mslots = 0;
+    if (other.Mslots)
+    {
+      Mslots = arena.allocate<uint32_t>(Mdimensions);
+      memcpy(Mslots, other.Mslots, Mdimensions*sizeof(uint32_t));
+    }
+  }
+
+  /*-------------------------------------------------------------------------*/
+  void FlatConfig::allocate(ParameterArena& arena)
+  {
+    Mnames = arena.allocate<uint32_t>(Msize);
+    Mvalues = arena.allocate<double>(Msize);
+    Muncertainties = arena.allocate<double>(Msize);
+    Mgrid = arena.allocate<unsigned char>(Msize);
+    Mcoordinates = arena.allocate<int32_t>(Msize);
+    Mtypes = arena.allocate<unsigned char>(Msubsystems);
+    Morders = arena.allocate<unsigned char>(Msubsystems);
+  } // function FlatConfig::allocate
+
+  /*-------------------------------------------------------------------------*/
+  void FlatConfig::store(unsigned int const idx,
+      std::shared_ptr<SystemParameter> const& param, Tprototypes& prototypes)
+  {
+    Mnames[idx] = packName(param->get_nam());
+    Mvalues[idx] = param->get_val();
+    Muncertainties[idx] = param->get_unc();
+    Mgrid[idx] = param->is_gridSystemParameter();
+    Mcoordinates[idx] = -1;
+    if (Mgrid[idx])
+    {
+      Mcoordinates[idx] = param->get_coordinateId();
+      std::shared_ptr<GridSystemParameter> grid_param(
+          std::dynamic_pointer_cast<GridSystemParameter>(param));
+      CALEX_assert(grid_param, "Illegal grid system parameter.");
+      // later modifications of the source must not affect the prototype
+      prototypes.push_back(std::shared_ptr<GridSystemParameter const>(
+            new GridSystemParameter(*grid_param)));
+      ++Mdimensions;
+    }
+  } // function FlatConfig::store
+
+  /*-------------------------------------------------------------------------*/
+  std::ostream& operator<<(std::ostream& os, FlatConfig const& config)
+  {
+    config.writeRelocated(os, config.text(config.Minfile),
+        config.text(config.Moutfile));
+    return os;
+  }
+
+  /*-------------------------------------------------------------------------*/
+  void FlatConfig::writeRelocated(std::ostream& os, std::string const& infile,
+      std::string const& outfile) const
+  {
+    os << text(Mcomment) << "\n" << std::endl;
+    os << "'" << infile << "'  input to seismo (file name)" << std::endl 
+      << "'" << outfile << "'  output from seismo (file name)\n" << std::endl;
+    os << text(Mcontrol);
+    unsigned int idx = 0;
+    for (; idx < 4; ++idx) { write(os, idx); }
+    os << std::endl;
+    for (; idx < 4+Mextra; ++idx) { write(os, idx); }
+    // first order subsystems are written before second order subsystems
+    for (unsigned char order = 1; order <= 2; ++order)
+    {
+      unsigned int first = 4+Mextra;
+      for (unsigned int k = 0; k < Msubsystems; ++k)
+      {
+        if (order == Morders[k])
+        {
+          os << (LP == Mtypes[k] ? "lp" : HP == Mtypes[k] ? "hp" : "bp")
+            << static_cast<unsigned int>(order) << std::endl;
+          for (idx = first; idx < first+order; ++idx) { write(os, idx); }
+          os << std::endl;
+        }
+        first += Morders[k];
+      }
+    }
+    os << "end" << std::endl;
+  } // function FlatConfig::writeRelocated
+
+  /*-------------------------------------------------------------------------*/
+  void FlatConfig::write(std::ostream& os, unsigned int const idx) const
+  {
+    // same format as calex::writeSystemParameter without allocating a
+    // string stream for every system parameter
+    char line[128];
+    uint32_t const id = Mnames[idx];
+    char const nam[] = {static_cast<char>(id & 0xff),
+      static_cast<char>((id >> 8) & 0xff),
+      static_cast<char>((id >> 16) & 0xff),
+      static_cast<char>((id >> 24) & 0xff), 0};
+    int const len = formatClassic(line, sizeof(line), "%s  %12.6f  %12.6f\n",
+        nam, Mvalues[idx], Muncertainties[idx]);
+    if (len < 0 || static_cast<size_t>(len) >= sizeof(line))
+    {
+      writeSystemParameter(os, unpackName(id), Mvalues[idx],
+          Muncertainties[idx]);
+      return;
+    }
+    os.write(line, len);
+  } // function FlatConfig::write
+
+  /*-------------------------------------------------------------------------*/
+  std::shared_ptr<SystemParameter> FlatConfig::restore(unsigned int const idx,
+      unsigned int& grid_idx) const
+  {
+    if (! Mgrid[idx])
+    {
+      return std::shared_ptr<SystemParameter>(new SystemParameter(
+            unpackName(Mnames[idx]), Mvalues[idx], Muncertainties[idx]));
+    }
+    std::shared_ptr<GridSystemParameter> param(
+        new GridSystemParameter(*MgridParameters->at(grid_idx++)));
+    param->set_val(Mvalues[idx]);
+    param->set_coordinateId(Mcoordinates[idx]);
+    return param;
+  } // function FlatConfig::restore
+
+  /*-------------------------------------------------------------------------*/
+  std::shared_ptr<CalexConfig> FlatConfig::toCalexConfig() const
+  {
+    std::shared_ptr<CalexConfig> config(new CalexConfig(text(Minfile),
+          text(Moutfile)));
+    config->set_comment(text(Mcomment));
+    config->set_alias(Malias);
+    config->set_m0(Mm0);
+    config->set_maxit(Mmaxit);
+    config->set_qac(Mqac);
+    config->set_finac(Mfinac);
+    config->set_ns1(Mns1);
+    config->set_ns2(Mns2);
+    unsigned int grid_idx = 0;
+    unsigned int idx = 0;
+    config->set_amp(restore(idx++, grid_idx));
+    config->set_del(restore(idx++, grid_idx));
+    config->set_sub(restore(idx++, grid_idx));
+    config->set_til(restore(idx++, grid_idx));
+    for (; idx < 4+Mextra; ++idx)
+    {
+      config->add_systemParameter(restore(idx, grid_idx));
+    }
+    for (unsigned int k = 0; k < Msubsystems; ++k)
+    {
+      EsubSystemType const type = static_cast<EsubSystemType>(Mtypes[k]);
+      std::shared_ptr<SystemParameter> per(restore(idx++, grid_idx));
+      if (1 == Morders[k])
+      {
+        config->add_subsystem(std::shared_ptr<CalexSubsystem>(
+              new FirstOrderSubsystem(type, per)));
+      } else
+      {
+        std::shared_ptr<SystemParameter> dmp(restore(idx++, grid_idx));
+        config->add_subsystem(std::shared_ptr<CalexSubsystem>(
+              new SecondOrderSubsystem(type, per, dmp)));
+      }
+    }
+    return config;
+  } // function FlatConfig::toCalexConfig
+
+  /*=========================================================================*/
+  uint32_t packName(std::string const& nam)
+  {
+    CALEX_assert(nam.size() <= sizeof(uint32_t),
+        "Illegal system parameter name.");
+    uint32_t id = 0;
+    for (size_t i = 0; i < nam.size(); ++i)
+    {
+      id |= static_cast<uint32_t>(static_cast<unsigned char>(nam[i])) << 8*i;
+    }
+    return id;
+  } // function packName
+
+  /*-------------------------------------------------------------------------*/
+  std::string unpackName(uint32_t const id)
+  {
+    char nam[sizeof(uint32_t)];
+    size_t len = 0;
+    for (; len < sizeof(uint32_t) && (id >> 8*len) & 0xff; ++len)
+    {
+      nam[len] = static_cast<char>((id >> 8*len) & 0xff);
+    }
+    return std::string(nam, len);
+  } // function unpackName
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+/* ----- END OF flatconfig.cc  ----- */
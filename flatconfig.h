@@ -0,0 +1,320 @@
+/*! \file flatconfig.h
+ * \brief Declaration of a compact representation of calex configurations.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Declaration of a compact representation of calex configurations.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  Strings within the arena; convert back into
+ *                    independent grid system parameters.
+ *
+ * ============================================================================
+ */
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <stdint.h>
+#include <calexxx/calexconfig.h>
+#include <calexxx/systemparameter.h>
+#include <calexxx/subsystem.h>
+#include <calexxx/error.h>
+
+#ifndef _CALEX_FLATCONFIG_H_
+#define _CALEX_FLATCONFIG_H_
+
+namespace calex
+{
+  /*=========================================================================*/
+  /*!
+   * Arena providing memory for calex::FlatConfig instances.
+   *
+   * Memory is handed out from large blocks by bumping an offset. Single
+   * allocations are never released; all memory is released at once by
+   * ParameterArena::clear or on destruction. An arena therefore must outlive
+   * all configurations allocated from it.
+   */
+  class ParameterArena
+  {
+    public:
+      /*!
+       * constructor
+       *
+       * \param block_size size of the blocks in bytes
+       */
+      explicit ParameterArena(size_t const block_size=65536);
+      //! destructor
+      ~ParameterArena();
+      /*!
+       * allocate memory
+       *
+       * \param bytes number of bytes
+       *
+       * \return memory aligned for any scalar type
+       */
+      void* allocate(size_t const bytes);
+      //! allocate an array of \a n elements
+      template <typename T>
+      T* allocate(size_t const n)
+      { return static_cast<T*>(allocate(n*sizeof(T))); }
+      //! release all memory handed out
+      void clear();
+      //! query function for the number of bytes handed out
+      size_t get_used() const { return Mused; }
+      //! query function for the number of bytes reserved
+      size_t get_reserved() const { return Mreserved; }
+
+    private:
+      //! copying is not allowed
+      ParameterArena(ParameterArena const&);
+      ParameterArena& operator=(ParameterArena const&);
+
+    private:
+      //! size of the blocks
+      size_t MblockSize;
+      //! blocks allocated
+      std::vector<char*> Mblocks;
+      //! offset of the free memory within the last block
+      size_t Moffset;
+      //! size of the last block
+      size_t MlastSize;
+      //! number of bytes handed out
+      size_t Mused;
+      //! number of bytes reserved
+      size_t Mreserved;
+
+  }; // class ParameterArena
+
+  /*=========================================================================*/
+  /*!
+   * Compact representation of a calex configuration.
+   *
+   * calex::CalexConfig stores every system parameter as a separately
+   * allocated calex::SystemParameter with virtual query functions.
+   * calex::FlatConfig instead stores the system parameters in contiguous
+   * arrays (structure of arrays) allocated from a calex::ParameterArena:
+   *  - name ids (the three characters of the name packed into an integer,
+   *    see calex::packName)
+   *  - values
+   *  - uncertainties
+   *  - grid flags
+   *  - coordinate ids (coordinate id of a grid system parameter, -1
+   *    otherwise)
+   *
+   * The parameters are stored in the order \c amp, \c del, \c sub, \c
+   * til, additional system parameters and the parameters of the subsystems
+   * in the order the subsystems were added to the configuration. The
+   * comment, the signal filenames and the control parameters are stored
+   * within a single text block of the arena, too.
+   *
+   * The identifier, the range and the unit of a grid system parameter are
+   * held by its optimize::StandardParameter base which cannot be flattened.
+   * Copies of the grid system parameters are therefore taken while
+   * flattening and kept in an immutable block shared by all copies of the
+   * flat configuration (a single reference count). They serve as prototypes
+   * for FlatConfig::toCalexConfig only and are never modified.
+   *
+   * A flat configuration is created from a calex::CalexConfig and can be
+   * converted back (see FlatConfig::toCalexConfig). It writes the calex
+   * parameter file and is updated with the coordinates of a node directly.
+   * The parameter files written are identical to the ones of
+   * calex::CalexConfig.
+   */
+  class FlatConfig
+  {
+    public:
+      /*!
+       * constructor - flatten a calex configuration
+       *
+       * \param config calex configuration
+       * \param arena arena the arrays are allocated from
+       */
+      FlatConfig(CalexConfig const& config, ParameterArena& arena);
+      /*!
+       * constructor - copy a flat configuration
+       *
+       * \param other flat configuration to be copied
+       * \param arena arena the arrays are allocated from
+       *
+       * Copying a flat configuration is much cheaper than copying a
+       * calex::CalexConfig since the arrays are copied with a few memcpy
+       * calls and no system parameter is allocated on the heap.
+       */
+      FlatConfig(FlatConfig const& other, ParameterArena& arena);
+      //! query function for the number of system parameters
+      unsigned int get_size() const { return Msize; }
+      //! query function for the number of grid system parameters
+      unsigned int get_dimensions() const { return Mdimensions; }
+      //! query function for the name ids
+      uint32_t const* get_names() const { return Mnames; }
+      //! query function for the values
+      double const* get_values() const { return Mvalues; }
+      //! query function for the uncertainties
+      double const* get_uncertainties() const { return Muncertainties; }
+      //! query function for the grid flags
+      unsigned char const* get_gridFlags() const { return Mgrid; }
+      //! query function for the coordinate ids
+      int32_t const* get_coordinates() const { return Mcoordinates; }
+      /*!
+       * update the grid system parameters
+       *
+       * \param data coordinates of a node
+       */
+      template <typename Ctype>
+      void update(std::vector<Ctype> const& data);
+      /*!
+       * write the parameter file referring to other signal files
+       *
+       * \param os output stream
+       * \param infile filename of the calibration signal
+       * \param outfile filename of the seismometer output signal
+       */
+      void writeRelocated(std::ostream& os, std::string const& infile,
+          std::string const& outfile) const;
+      /*!
+       * convert into a calex configuration
+       *
+       * All system parameters are recreated with the values of the flat
+       * configuration; grid system parameters are copied from their
+       * prototypes. Configurations converted back therefore neither share
+       * system parameters with each other nor with the configuration the
+       * flat configuration was created from. The configuration returned
+       * must be synchronized before updating it.
+       */
+      std::shared_ptr<CalexConfig> toCalexConfig() const;
+
+      //! overloaded ostream operator
+      friend std::ostream& operator<<(std::ostream& os,
+          FlatConfig const& config);
+
+    private:
+      //! copying without arena is not allowed
+      FlatConfig(FlatConfig const&);
+      FlatConfig& operator=(FlatConfig const&);
+      //! allocate the arrays
+      void allocate(ParameterArena& arena);
+      //! prototypes of the grid system parameters
+      typedef std::vector<std::shared_ptr<GridSystemParameter const>>
+        Tprototypes;
+      //! store a system parameter
+      void store(unsigned int const idx,
+          std::shared_ptr<SystemParameter> const& param,
+          Tprototypes& prototypes);
+      //! query function for a string of the text block
+      char const* text(uint32_t const offset) const { return Mtext+offset; }
+      //! write a system parameter
+      void write(std::ostream& os, unsigned int const idx) const;
+      //! create a system parameter
+      std::shared_ptr<SystemParameter> restore(unsigned int const idx,
+          unsigned int& grid_idx) const;
+
+    private:
+      //! NUL terminated strings
+      char* Mtext;
+      //! size of the text block
+      uint32_t MtextSize;
+      //! offset of the header line of calex parameter file
+      uint32_t Mcomment;
+      //! offset of the filename of the calibration signal
+      uint32_t Minfile;
+      //! offset of the filename of the seismometer output signal
+      uint32_t Moutfile;
+      //! offset of the control parameters as written to the file
+      uint32_t Mcontrol;
+      //! control parameters of the iteration
+      float Malias;
+      unsigned int Mm0;
+      unsigned int Mmaxit;
+      double Mqac;
+      double Mfinac;
+      int Mns1;
+      int Mns2;
+      //! number of system parameters
+      unsigned int Msize;
+      //! number of additional system parameters
+      unsigned int Mextra;
+      //! number of subsystems
+      unsigned int Msubsystems;
+      //! number of grid system parameters
+      unsigned int Mdimensions;
+      //! name ids of the system parameters
+      uint32_t* Mnames;
+      //! values of the system parameters
+      double* Mvalues;
+      //! uncertainties of the system parameters
+      double* Muncertainties;
+      //! flags marking grid system parameters
+      unsigned char* Mgrid;
+      //! coordinate ids of grid system parameters, -1 otherwise
+      int32_t* Mcoordinates;
+      //! index of the system parameter of each coordinate id
+      uint32_t* Mslots;
+      //! types of the subsystems
+      unsigned char* Mtypes;
+      //! orders of the subsystems
+      unsigned char* Morders;
+      //! prototypes of the grid system parameters in the order they are stored
+      std::shared_ptr<Tprototypes const> MgridParameters;
+
+  }; // class FlatConfig
+
+  /*=========================================================================*/
+  /*!
+   * pack a system parameter name into an integer id
+   *
+   * \param nam name of three characters
+   */
+  uint32_t packName(std::string const& nam);
+  /*!
+   * unpack an integer id into a system parameter name
+   *
+   * \param id id created by calex::packName
+   */
+  std::string unpackName(uint32_t const id);
+
+  /*=========================================================================*/
+  template <typename Ctype>
+  void FlatConfig::update(std::vector<Ctype> const& data)
+  {
+    CALEX_assert(Mslots, "Parameters not synchronized.");
+    CALEX_assert(data.size() == Mdimensions,
+        "Invalid parameter configuration.");
+    for (size_t idx = 0; idx < data.size(); ++idx)
+    {
+      Mvalues[Mslots[idx]] = data[idx];
+    }
+  } // function template FlatConfig::update
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+#endif // include guard
+
+/* ----- END OF flatconfig.h  ----- */
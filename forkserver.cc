@@ -0,0 +1,341 @@
+/*! \file forkserver.cc
+ * \brief Implementation of a fork server launching calex processes.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Implementation of a fork server launching calex processes.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  support working directory of spawned processes
+ * 17/10/2026   V0.3  pass spawn options; forward an inherited stdout
+ *                    descriptor
+ * 17/10/2026   V0.4  forward CPU and NUMA placement of spawned processes
+ *
+ * ============================================================================
+ */
+
+#include <cstring>
+#include <cstdlib>
+#include <sstream>
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/signalfd.h>
+#include <sys/wait.h>
+#include <calexxx/forkserver.h>
+#include <calexxx/launcher.h>
+#include <calexxx/error.h>
+
+namespace calex
+{
+  namespace
+  {
+    //! maximum size of a spawn request
+    const size_t CALEX_FORKSERVER_MSGSIZE = 65536;
+
+    //! reply message of the helper process
+    struct Reply
+    {
+      //! process id (first reply) or raw wait status (second reply)
+      int Mvalue;
+      //! resource usage (second reply only)
+      struct rusage Musage;
+    }; // struct Reply
+
+    /*-----------------------------------------------------------------------*/
+    //! receive a reply and restart on interrupts
+    ssize_t receiveReply(int const fd, Reply& reply)
+    {
+      ssize_t retval;
+      do
+      {
+        retval = recv(fd, &reply, sizeof(Reply), 0);
+      } while (-1 == retval && EINTR == errno);
+      return retval;
+    }
+
+    /*-----------------------------------------------------------------------*/
+    //! send a reply to the host
+    void sendReply(int const fd, int const value, struct rusage const* usage)
+    {
+      Reply reply;
+      memset(&reply, 0, sizeof(Reply));
+      reply.Mvalue = value;
+      if (usage) { reply.Musage = *usage; }
+      send(fd, &reply, sizeof(Reply), MSG_NOSIGNAL);
+    }
+
+  } // namespace (unnamed)
+
+  /*=========================================================================*/
+  CalexForkServer::~CalexForkServer()
+  {
+    if (! isRunning()) { return; }
+    for (auto it(Mreplies.begin()); it != Mreplies.end(); ++it)
+    {
+      close(it->second);
+    }
+    // the helper terminates as soon as it reads EOF on the control socket
+    close(Msocket);
+    while (-1 == waitpid(Mpid, 0, 0) && EINTR == errno) { }
+  }
+
+  /*-------------------------------------------------------------------------*/
+  void CalexForkServer::start()
+  {
+    CALEX_assert(! isRunning(), "Fork server already running.");
+    int sv[2];
+    CALEX_assert(0 == socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0,
+          sv), "Error while creating fork server socket pair.");
+    pid_t pid = fork();
+    CALEX_assert(-1 != pid, "Error while forking fork server.");
+    if (0 == pid)
+    {
+      close(sv[0]);
+      Msocket = sv[1];
+      try { serve(); } catch (...) { _exit(1); }
+      _exit(0);
+    }
+    close(sv[1]);
+    Msocket = sv[0];
+    Mpid = pid;
+  } // function CalexForkServer::start
+
+  /*-------------------------------------------------------------------------*/
+  pid_t CalexForkServer::spawn(std::vector<std::string> const& args,
+      SpawnOptions const& options)
+  {
+    CALEX_assert(isRunning(), "Fork server not running.");
+    CALEX_assert(! args.empty(), "Empty argument vector.");
+    // request: NUL-terminated stdout path, working directory, CPU and NUMA
+    // node followed by the argument vector
+    std::ostringstream oss;
+    oss << options.Mstdout << '\0' << options.Mworkdir << '\0'
+      << options.Mcpu << '\0' << options.MmemNode << '\0';
+    std::string msg(oss.str());
+    for (auto cit(args.cbegin()); cit != args.cend(); ++cit)
+    {
+      msg += *cit;
+      msg.push_back('\0');
+    }
+    CALEX_assert(msg.size() <= CALEX_FORKSERVER_MSGSIZE,
+        "Spawn request too large.");
+
+    // private reply channel passed to the helper
+    int rsv[2];
+    CALEX_assert(0 == socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0,
+          rsv), "Error while creating reply socket pair.");
+
+    struct iovec iov;
+    iov.iov_base = const_cast<char*>(msg.data());
+    iov.iov_len = msg.size();
+    // the reply socket is passed first, the stdout descriptor second
+    int fds[2] = { rsv[1], options.MstdoutFd };
+    int nfds = options.MstdoutFd >= 0 ? 2 : 1;
+    char control[CMSG_SPACE(2*sizeof(int))];
+    memset(control, 0, sizeof(control));
+    struct msghdr hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.msg_iov = &iov;
+    hdr.msg_iovlen = 1;
+    hdr.msg_control = control;
+    hdr.msg_controllen = CMSG_SPACE(nfds*sizeof(int));
+    struct cmsghdr* cmsg = CMSG_FIRSTHDR(&hdr);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(nfds*sizeof(int));
+    memcpy(CMSG_DATA(cmsg), fds, nfds*sizeof(int));
+
+    ssize_t retval;
+    {
+      boost::lock_guard<boost::mutex> lock(Mmutex);
+      do
+      {
+        retval = sendmsg(Msocket, &hdr, MSG_NOSIGNAL);
+      } while (-1 == retval && EINTR == errno);
+    }
+    close(rsv[1]);
+    if (static_cast<ssize_t>(msg.size()) != retval)
+    {
+      close(rsv[0]);
+      CALEX_abort("Error while sending spawn request.");
+    }
+
+    Reply reply;
+    if (sizeof(Reply) != receiveReply(rsv[0], reply) || reply.Mvalue <= 0)
+    {
+      close(rsv[0]);
+      CALEX_abort("Fork server failed to spawn process.");
+    }
+    {
+      boost::lock_guard<boost::mutex> lock(Mmutex);
+      Mreplies[reply.Mvalue] = rsv[0];
+    }
+    return reply.Mvalue;
+  } // function CalexForkServer::spawn
+
+  /*-------------------------------------------------------------------------*/
+  int CalexForkServer::wait(pid_t const pid, struct rusage* usage)
+  {
+    int fd;
+    {
+      boost::lock_guard<boost::mutex> lock(Mmutex);
+      auto it(Mreplies.find(pid));
+      CALEX_assert(Mreplies.end() != it, "Unknown process id.");
+      fd = it->second;
+      Mreplies.erase(it);
+    }
+    Reply reply;
+    ssize_t retval = receiveReply(fd, reply);
+    close(fd);
+    CALEX_assert(sizeof(Reply) == retval,
+        "Error while waiting for calex process.");
+    if (usage) { *usage = reply.Musage; }
+    return reply.Mvalue;
+  } // function CalexForkServer::wait
+
+  /*-------------------------------------------------------------------------*/
+  void CalexForkServer::serve()
+  {
+    // child processes are reaped synchronously by means of a signalfd
+    sigset_t mask;
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGCHLD);
+    sigprocmask(SIG_BLOCK, &mask, 0);
+    int sfd = signalfd(-1, &mask, SFD_CLOEXEC);
+    CALEX_assert(-1 != sfd, "Error while creating signalfd.");
+
+    std::map<pid_t, int> replies;
+    std::vector<char> buf(CALEX_FORKSERVER_MSGSIZE);
+    bool open = true;
+    while (open || ! replies.empty())
+    {
+      struct pollfd fds[2];
+      fds[0].fd = sfd;
+      fds[0].events = POLLIN;
+      fds[1].fd = open ? Msocket : -1;
+      fds[1].events = POLLIN;
+      if (-1 == poll(fds, 2, -1))
+      {
+        if (EINTR == errno) { continue; }
+        break;
+      }
+
+      // reap terminated processes
+      if (fds[0].revents & POLLIN)
+      {
+        struct signalfd_siginfo info;
+        while (-1 == read(sfd, &info, sizeof(info)) && EINTR == errno) { }
+        int status;
+        struct rusage usage;
+        pid_t pid;
+        while (0 < (pid = wait4(-1, &status, WNOHANG, &usage)))
+        {
+          auto it(replies.find(pid));
+          if (replies.end() != it)
+          {
+            sendReply(it->second, status, &usage);
+            close(it->second);
+            replies.erase(it);
+          }
+        }
+      }
+
+      // handle spawn requests
+      if (fds[1].revents & (POLLIN | POLLHUP | POLLERR))
+      {
+        struct iovec iov;
+        iov.iov_base = &buf[0];
+        iov.iov_len = buf.size();
+        char control[CMSG_SPACE(2*sizeof(int))];
+        struct msghdr hdr;
+        memset(&hdr, 0, sizeof(hdr));
+        hdr.msg_iov = &iov;
+        hdr.msg_iovlen = 1;
+        hdr.msg_control = control;
+        hdr.msg_controllen = sizeof(control);
+        ssize_t len = recvmsg(Msocket, &hdr, MSG_CMSG_CLOEXEC);
+        if (-1 == len && EINTR == errno) { continue; }
+        if (len <= 0) { open = false; continue; }
+
+        struct cmsghdr* cmsg = CMSG_FIRSTHDR(&hdr);
+        if (! cmsg || SCM_RIGHTS != cmsg->cmsg_type) { continue; }
+        int fds[2] = { -1, -1 };
+        size_t nfds = (cmsg->cmsg_len-CMSG_LEN(0))/sizeof(int);
+        memcpy(fds, CMSG_DATA(cmsg), std::min<size_t>(nfds, 2)*sizeof(int));
+        int reply_fd = fds[0];
+
+        // decode request
+        std::vector<std::string> fields;
+        char const* cur = &buf[0];
+        char const* end = &buf[0]+len;
+        while (cur < end)
+        {
+          fields.push_back(std::string(cur));
+          cur += fields.back().size()+1;
+        }
+        if (fields.size() < 5)
+        {
+          sendReply(reply_fd, -EINVAL, 0);
+          close(reply_fd);
+          if (-1 != fds[1]) { close(fds[1]); }
+          continue;
+        }
+        std::vector<std::string> args(fields.begin()+4, fields.end());
+        SpawnOptions options;
+        options.Mstdout = fields[0];
+        options.Mworkdir = fields[1];
+        options.Mcpu = atoi(fields[2].c_str());
+        options.MmemNode = atoi(fields[3].c_str());
+        options.MstdoutFd = fds[1];
+        try
+        {
+          pid_t pid = spawnProcess(args, options);
+          sendReply(reply_fd, pid, 0);
+          replies[pid] = reply_fd;
+        }
+        catch (Exception&)
+        {
+          sendReply(reply_fd, -ECHILD, 0);
+          close(reply_fd);
+        }
+        // the child holds its own copy of the stdout descriptor
+        if (-1 != fds[1]) { close(fds[1]); }
+      }
+    }
+    close(sfd);
+    close(Msocket);
+  } // function CalexForkServer::serve
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+/* ----- END OF forkserver.cc  ----- */
@@ -0,0 +1,139 @@
+/*! \file forkserver.h
+ * \brief Declaration of a fork server launching calex processes.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Declaration of a fork server launching calex processes.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  support working directory of spawned processes
+ * 17/10/2026   V0.3  pass spawn options; forward an inherited stdout
+ *                    descriptor
+ * 17/10/2026   V0.4  forward CPU and NUMA placement of spawned processes
+ *
+ * ============================================================================
+ */
+
+#include <string>
+#include <vector>
+#include <map>
+#include <sys/types.h>
+#include <sys/resource.h>
+#include <boost/thread.hpp>
+#include <calexxx/error.h>
+
+#ifndef _CALEX_FORKSERVER_H_
+#define _CALEX_FORKSERVER_H_
+
+namespace calex
+{
+  struct SpawnOptions;
+
+  /*=========================================================================*/
+  /*!
+   * Fork server for calex processes.
+   *
+   * Hosts using \a liboptimizexx might hold a large address space and a lot
+   * of threads. Spawning a process from such a host serializes on the kernel
+   * memory management lock and the cost of a launch grows with the size of
+   * the host. The fork server is a small helper process which is forked
+   * once by CalexForkServer::start while the host still is small, i.e. \b
+   * before the parameter space grid had been built and \b before any
+   * threads had been started. Afterwards spawn requests are sent to the
+   * helper over a \c socketpair and the helper spawns calex on behalf of the
+   * host. Launch costs then do not depend anymore on the host's memory size.
+   *
+   * Every request carries a private reply socket (passed with \c
+   * SCM_RIGHTS) and optionally the descriptor \c stdout of the process is
+   * connected to (see calex::SpawnOptions::MstdoutFd). The helper answers
+   * with the process id of the spawned process and, once the process
+   * terminated, with its raw wait status and its resource usage. Therefore
+   * any number of threads may use the server concurrently.
+   *
+   * The helper terminates as soon as the host closed its end of the control
+   * socket, i.e. on destruction of the fork server.
+   */
+  class CalexForkServer
+  {
+    public:
+      //! constructor
+      CalexForkServer() : Msocket(-1), Mpid(-1) { }
+      //! destructor (shuts the helper process down)
+      ~CalexForkServer();
+      //! fork the helper process
+      void start();
+      //! query function if helper process is running
+      bool isRunning() const { return -1 != Mpid; }
+      //! query function for the process id of the helper process
+      pid_t get_pid() const { return Mpid; }
+      /*!
+       * spawn a process by means of the helper process
+       *
+       * \param args Argument vector. The first argument is the path of the
+       * executable.
+       * \param options Redirection and working directory of the process.
+       *
+       * \return process id of the spawned process
+       */
+      pid_t spawn(std::vector<std::string> const& args,
+          SpawnOptions const& options);
+      /*!
+       * wait for a process spawned by CalexForkServer::spawn
+       *
+       * \param pid process id
+       * \param usage If not zero the resource usage of the process is stored.
+       *
+       * \return raw wait status
+       */
+      int wait(pid_t const pid, struct rusage* usage=0);
+
+    private:
+      //! server loop running in the helper process
+      void serve();
+      //! copying is not allowed
+      CalexForkServer(CalexForkServer const&);
+      CalexForkServer& operator=(CalexForkServer const&);
+
+    private:
+      //! host end of the control socket
+      int Msocket;
+      //! process id of the helper process
+      pid_t Mpid;
+      //! reply sockets of processes in flight
+      std::map<pid_t, int> Mreplies;
+      //! mutual exclusion for the control socket and the reply map
+      boost::mutex Mmutex;
+
+  }; // class CalexForkServer
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+#endif // include guard
+
+/* ----- END OF forkserver.h  ----- */
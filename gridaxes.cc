@@ -0,0 +1,111 @@
+/*! \file gridaxes.cc
+ * \brief Implementation of the regular axes of a parameter space grid.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Implementation of the regular axes of a parameter space grid.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ *
+ * ============================================================================
+ */
+
+#include <cmath>
+#include <calexxx/gridaxes.h>
+#include <calexxx/systemparameter.h>
+#include <calexxx/error.h>
+
+namespace calex
+{
+  /*=========================================================================*/
+  GridAxes::Axis::Axis(std::string const& name, double const start,
+      double const end, double const delta) : Mname(name), Mstart(start),
+    Mend(end), Mdelta(delta), Msamples(0)
+  {
+    CALEX_assert(delta > 0. && end >= start,
+        "Invalid axis of parameter space.");
+    // tolerate rounding errors of the grid's extent
+    Msamples = static_cast<unsigned int>(
+        std::floor((end-start)/delta+1e-9))+1;
+  }
+
+  /*=========================================================================*/
+  GridAxes::GridAxes(CalexConfig const& config)
+  {
+    CALEX_assert(config.MisSynchronized, "Parameters not synchronized.");
+    for (auto cit(config.McoordinateTable.cbegin());
+        cit != config.McoordinateTable.cend(); ++cit)
+    {
+      opt::StandardParameter<double> const& param(**cit);
+      Maxes.push_back(Axis((*cit)->get_nam(), param.get_start(),
+            param.get_end(), param.get_delta()));
+    }
+    initialize();
+  }
+
+  /*-------------------------------------------------------------------------*/
+  GridAxes::GridAxes(Taxes const& axes) : Maxes(axes)
+  {
+    for (auto cit(Maxes.cbegin()); cit != Maxes.cend(); ++cit)
+    {
+      CALEX_assert(cit->Mdelta > 0. && cit->Msamples > 0,
+          "Invalid axis of parameter space.");
+    }
+    initialize();
+  }
+
+  /*-------------------------------------------------------------------------*/
+  void GridAxes::initialize()
+  {
+    CALEX_assert(! Maxes.empty(), "Parameter space without dimensions.");
+    Mstrides.assign(Maxes.size(), 1);
+    Msize = 1;
+    for (size_t i = Maxes.size(); i-- > 0; )
+    {
+      Mstrides[i] = Msize;
+      Msize *= Maxes[i].Msamples;
+    }
+  } // function GridAxes::initialize
+
+  /*-------------------------------------------------------------------------*/
+  std::vector<double> GridAxes::coordinates(size_t const index) const
+  {
+    CALEX_assert(index < Msize, "Coordinate index out of range.");
+    std::vector<double> coordinates(Maxes.size());
+    for (size_t i = 0; i < Maxes.size(); ++i)
+    {
+      coordinates[i] = Maxes[i].Mstart+
+        ((index/Mstrides[i]) % Maxes[i].Msamples)*Maxes[i].Mdelta;
+    }
+    return coordinates;
+  } // function GridAxes::coordinates
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+/* ----- END OF gridaxes.cc  ----- */
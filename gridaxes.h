@@ -0,0 +1,167 @@
+/*! \file gridaxes.h
+ * \brief Declaration of the regular axes of a parameter space grid.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Declaration of the regular axes of a parameter space grid.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ *
+ * ============================================================================
+ */
+
+#include <string>
+#include <vector>
+#include <calexxx/calexconfig.h>
+#include <calexxx/error.h>
+
+#ifndef _CALEX_GRIDAXES_H_
+#define _CALEX_GRIDAXES_H_
+
+namespace calex
+{
+  /*=========================================================================*/
+  /*!
+   * Regular axes of a parameter space grid.
+   *
+   * Every grid system parameter spans an axis from its start to its end
+   * value with its delta. The nodes of the grid are enumerated by a
+   * coordinate index in row-major order, i.e. the coordinate of the last
+   * coordinate id varies fastest. calex::ResultStore and calex::MisfitCube
+   * store the data of a node at its coordinate index.
+   */
+  class GridAxes
+  {
+    public:
+      //! regular axis of the parameter space
+      struct Axis
+      {
+        //! constructor
+        Axis() : Mstart(0.), Mend(0.), Mdelta(1.), Msamples(1) { }
+        /*!
+         * constructor
+         *
+         * \param name name of the grid system parameter
+         * \param start first coordinate
+         * \param end last coordinate (rounded down to the lattice)
+         * \param delta distance of the coordinates
+         */
+        Axis(std::string const& name, double const start, double const end,
+            double const delta);
+        //! name of the grid system parameter
+        std::string Mname;
+        //! first coordinate
+        double Mstart;
+        //! end of the axis as configured
+        double Mend;
+        //! distance of the coordinates
+        double Mdelta;
+        //! number of coordinates
+        unsigned int Msamples;
+      }; // struct Axis
+      //! axes of the parameter space ordered by coordinate id
+      typedef std::vector<Axis> Taxes;
+      //! index of no node
+      static const size_t npos = static_cast<size_t>(-1);
+
+    public:
+      /*!
+       * constructor
+       *
+       * \param config Synchronized configuration providing the axes of its
+       * grid system parameters.
+       */
+      explicit GridAxes(CalexConfig const& config);
+      /*!
+       * constructor
+       *
+       * \param axes axes of the parameter space
+       */
+      explicit GridAxes(Taxes const& axes);
+      //! query function for the number of nodes
+      size_t size() const { return Msize; }
+      //! query function for the number of dimensions
+      unsigned int get_dimensions() const { return Maxes.size(); }
+      //! query function for the axes
+      Taxes const& get_axes() const { return Maxes; }
+      //! query function for an axis
+      Axis const& operator[](size_t const i) const { return Maxes[i]; }
+      /*!
+       * query function for the distance of the coordinate indexes of
+       * neighbouring nodes along a dimension
+       */
+      size_t get_stride(size_t const i) const { return Mstrides[i]; }
+      /*!
+       * compute the coordinate index of a node
+       *
+       * \param coordinates coordinates of the node
+       *
+       * \return coordinate index or GridAxes::npos if the coordinates are not
+       * within the parameter space (e.g. nodes of subgrids of another
+       * dimension)
+       */
+      template <typename Ctype>
+      size_t index(std::vector<Ctype> const& coordinates) const;
+      //! compute the coordinates of the node with coordinate index \a index
+      std::vector<double> coordinates(size_t const index) const;
+
+    private:
+      //! compute the strides and the number of nodes
+      void initialize();
+
+    private:
+      //! axes of the parameter space
+      Taxes Maxes;
+      //! distance of consecutive coordinates of each dimension in the index
+      std::vector<size_t> Mstrides;
+      //! number of nodes
+      size_t Msize;
+
+  }; // class GridAxes
+
+  /*=========================================================================*/
+  template <typename Ctype>
+  size_t GridAxes::index(std::vector<Ctype> const& coordinates) const
+  {
+    if (coordinates.size() != Maxes.size()) { return npos; }
+    size_t index = 0;
+    for (size_t i = 0; i < Maxes.size(); ++i)
+    {
+      double const x = (coordinates[i]-Maxes[i].Mstart)/Maxes[i].Mdelta;
+      if (! (x > -0.5 && x < Maxes[i].Msamples-0.5)) { return npos; }
+      index += static_cast<size_t>(x+0.5)*Mstrides[i];
+    }
+    return index;
+  } // function template GridAxes::index
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+#endif // include guard
+
+/* ----- END OF gridaxes.h  ----- */
@@ -0,0 +1,236 @@
+/*! \file launcher.cc
+ * \brief Implementation of a process launcher for the external calex program.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Implementation of a process launcher for the external calex
+ * program.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  optionally delegate launches to calex::CalexForkServer;
+ *                    report resource usage
+ * 17/10/2026   V0.3  support working directory of calex processes
+ * 17/10/2026   V0.4  collect spawn options in calex::SpawnOptions; support
+ *                    an inherited stdout descriptor
+ * 17/10/2026   V0.5  CPU and NUMA placement of spawned processes
+ * 17/10/2026   V0.6  relative program paths are made absolute such that they
+ *                    remain valid in a different working directory
+ *
+ * ============================================================================
+ */
+
+#include <cstdlib>
+#include <cerrno>
+#include <csignal>
+#include <vector>
+#include <spawn.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <calexxx/launcher.h>
+#include <calexxx/scratchdir.h>
+#include <calexxx/placement.h>
+#include <calexxx/error.h>
+
+extern char** environ;
+
+// posix_spawn_file_actions_addchdir_np is provided since glibc 2.29
+#if defined(__GLIBC__) && \
+  ((__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 29))
+#define CALEX_HAVE_SPAWN_CHDIR
+#endif
+
+namespace calex
+{
+#ifndef CALEX_HAVE_SPAWN_CHDIR
+  namespace
+  {
+    /*!
+     * fallback for a working directory if posix_spawn is not able to change
+     * it
+     */
+    pid_t forkProcess(std::vector<std::string> const& args,
+        SpawnOptions const& options)
+    {
+      std::vector<char*> argv(args.size()+1, 0);
+      for (size_t i = 0; i < args.size(); ++i)
+      {
+        argv[i] = const_cast<char*>(args[i].c_str());
+      }
+      pid_t pid = fork();
+      CALEX_assert(-1 != pid, "Error while spawning calex process.");
+      if (0 == pid)
+      {
+        // only async-signal-safe functions from here on
+        sigset_t mask;
+        sigemptyset(&mask);
+        sigprocmask(SIG_SETMASK, &mask, 0);
+        if (0 != chdir(options.Mworkdir.c_str())) { _exit(127); }
+        int in = open("/dev/null", O_RDONLY);
+        int out = options.MstdoutFd;
+        if (out < 0)
+        {
+          out = open(options.Mstdout.c_str(), O_WRONLY | O_CREAT | O_TRUNC,
+              0644);
+        }
+        if (-1 == in || -1 == out) { _exit(127); }
+        dup2(in, STDIN_FILENO);
+        dup2(out, STDOUT_FILENO);
+        dup2(out, STDERR_FILENO);
+        execve(argv[0], &argv[0], environ);
+        _exit(127);
+      }
+      return pid;
+    } // function forkProcess
+
+  } // namespace (unnamed)
+
+#endif
+
+  /*=========================================================================*/
+  CalexLauncher::CalexLauncher(std::string const program) :
+    Mprogram(absolutePath(resolveProgram(program)))
+  { }
+
+  /*-------------------------------------------------------------------------*/
+  pid_t CalexLauncher::spawn(std::string const& param_path,
+      SpawnOptions const& options) const
+  {
+    std::vector<std::string> args;
+    args.push_back(Mprogram);
+    args.push_back(param_path);
+    if (MforkServer) { return MforkServer->spawn(args, options); }
+    return spawnProcess(args, options);
+  } // function CalexLauncher::spawn
+
+  /*-------------------------------------------------------------------------*/
+  int CalexLauncher::wait(pid_t const pid, struct rusage* usage) const
+  {
+    if (MforkServer) { return MforkServer->wait(pid, usage); }
+    int status;
+    pid_t retval;
+    do
+    {
+      retval = wait4(pid, &status, 0, usage);
+    } while (-1 == retval && EINTR == errno);
+    CALEX_assert(pid == retval, "Error while waiting for calex process.");
+    return status;
+  } // function CalexLauncher::wait
+
+  /*=========================================================================*/
+  pid_t spawnProcess(std::vector<std::string> const& args,
+      SpawnOptions const& options)
+  {
+    CALEX_assert(! args.empty(), "Empty argument vector.");
+    // the process inherits CPU affinity and memory policy of this thread
+    ThreadPlacement placement(options.Mcpu, options.MmemNode);
+    posix_spawn_file_actions_t actions;
+    CALEX_assert(0 == posix_spawn_file_actions_init(&actions),
+        "Error while initializing spawn file actions.");
+    if (! options.Mworkdir.empty())
+    {
+#ifdef CALEX_HAVE_SPAWN_CHDIR
+      posix_spawn_file_actions_addchdir_np(&actions, options.Mworkdir.c_str());
+#else
+      posix_spawn_file_actions_destroy(&actions);
+      return forkProcess(args, options);
+#endif
+    }
+    posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, "/dev/null",
+        O_RDONLY, 0);
+    if (options.MstdoutFd >= 0)
+    {
+      posix_spawn_file_actions_adddup2(&actions, options.MstdoutFd,
+          STDOUT_FILENO);
+    }
+    else
+    {
+      posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO,
+          options.Mstdout.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    }
+    posix_spawn_file_actions_adddup2(&actions, STDOUT_FILENO, STDERR_FILENO);
+
+    // do not pass a blocked signal mask (e.g. of the fork server) to calex
+    posix_spawnattr_t attr;
+    posix_spawnattr_init(&attr);
+    sigset_t mask;
+    sigemptyset(&mask);
+    posix_spawnattr_setsigmask(&attr, &mask);
+    posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGMASK);
+
+    // argv must not be const for posix_spawn
+    std::vector<std::vector<char>> buffers(args.size());
+    std::vector<char*> argv(args.size()+1, 0);
+    for (size_t i = 0; i < args.size(); ++i)
+    {
+      buffers[i].assign(args[i].begin(), args[i].end());
+      buffers[i].push_back('\0');
+      argv[i] = &buffers[i][0];
+    }
+
+    pid_t pid;
+    int retval = posix_spawn(&pid, argv[0], &actions, &attr, &argv[0],
+        environ);
+    posix_spawnattr_destroy(&attr);
+    posix_spawn_file_actions_destroy(&actions);
+    CALEX_assert(0 == retval, "Error while spawning calex process.");
+    return pid;
+  } // function spawnProcess
+
+  /*-------------------------------------------------------------------------*/
+  std::string resolveProgram(std::string const& program)
+  {
+    CALEX_assert(! program.empty(), "Empty program name.");
+    if (std::string::npos != program.find('/')) { return program; }
+
+    char const* path_env = getenv("PATH");
+    std::string path(path_env ? path_env : "/usr/local/bin:/usr/bin:/bin");
+    std::string::size_type pos = 0;
+    while (pos <= path.size())
+    {
+      std::string::size_type end = path.find(':', pos);
+      if (std::string::npos == end) { end = path.size(); }
+      // an empty PATH entry denotes the current working directory
+      std::string dir(path.substr(pos, end-pos));
+      std::string candidate((dir.empty() ? "." : dir)+"/"+program);
+      if (0 == access(candidate.c_str(), X_OK)) { return candidate; }
+      pos = end+1;
+    }
+    CALEX_abort("Executable not found in PATH.");
+  } // function resolveProgram
+
+  /*-------------------------------------------------------------------------*/
+  bool exitedSuccessfully(int const status)
+  {
+    return WIFEXITED(status) && 0 == WEXITSTATUS(status);
+  } // function exitedSuccessfully
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+/* ----- END OF launcher.cc  ----- */
@@ -0,0 +1,214 @@
+/*! \file launcher.h
+ * \brief Declaration of a process launcher for the external calex program.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Declaration of a process launcher for the external calex program.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  optionally delegate launches to calex::CalexForkServer;
+ *                    report resource usage
+ * 17/10/2026   V0.3  support working directory of calex processes
+ * 17/10/2026   V0.4  collect spawn options in calex::SpawnOptions; support
+ *                    an inherited stdout descriptor
+ * 17/10/2026   V0.5  CPU and NUMA placement of spawned processes
+ *
+ * ============================================================================
+ */
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <sys/types.h>
+#include <sys/resource.h>
+#include <calexxx/forkserver.h>
+#include <calexxx/error.h>
+
+#ifndef _CALEX_LAUNCHER_H_
+#define _CALEX_LAUNCHER_H_
+
+namespace calex
+{
+  /*=========================================================================*/
+  /*!
+   * Options for a process launch.
+   */
+  struct SpawnOptions
+  {
+    //! constructor
+    SpawnOptions() : Mstdout("/dev/null"), MstdoutFd(-1), Mcpu(-1),
+      MmemNode(-1)
+    { }
+    /*!
+     * File \c stdout and \c stderr of the process are redirected to.
+     * Relative paths are interpreted relative to SpawnOptions::Mworkdir.
+     */
+    std::string Mstdout;
+    /*!
+     * If not negative \c stdout and \c stderr of the process are connected
+     * to this descriptor instead of SpawnOptions::Mstdout, e.g. the write end
+     * of a pipe.
+     */
+    int MstdoutFd;
+    /*!
+     * Working directory of the process. If empty the process inherits the
+     * working directory of the caller.
+     */
+    std::string Mworkdir;
+    //! CPU the process is pinned to (not pinned if negative)
+    int Mcpu;
+    /*!
+     * NUMA node the process preferably allocates memory on (default memory
+     * policy if negative)
+     */
+    int MmemNode;
+
+  }; // struct SpawnOptions
+
+  /*=========================================================================*/
+  /*!
+   * Launcher for Erhard Wielandt's calex program.
+   *
+   * The calex executable is resolved once while constructing the launcher by
+   * searching the directories of the \c PATH environment variable. Every
+   * calex process afterwards is spawned directly using \c posix_spawn with
+   * explicit file actions redirecting \c stdout and \c stderr. Compared to
+   * \c system() no \c /bin/sh is started, no \c PATH lookup takes place and
+   * signals of the calling process are not blocked.
+   *
+   * Processes are reaped with \c wait4. The raw wait status is returned
+   * such that it can be passed to calex::CalexResult::set_exitStatus.
+   *
+   * If a calex::CalexForkServer had been assigned launches are delegated to
+   * the fork server's helper process.
+   */
+  class CalexLauncher
+  {
+    public:
+      /*!
+       * constructor
+       *
+       * \param program Name or path of the calex executable. If \a program
+       * does not contain a slash it will be searched in \c PATH. A relative
+       * path is made absolute with respect to the current working directory
+       * since calex processes may be spawned in scratch directories.
+       */
+      CalexLauncher(std::string const program="calex");
+      //! destructor
+      virtual ~CalexLauncher() { }
+      //! query function for the resolved path of the calex executable
+      std::string const& get_program() const { return Mprogram; }
+      /*!
+       * delegate launches to a fork server
+       *
+       * \param server Running fork server. Pass an empty pointer to spawn
+       * calex directly again.
+       */
+      void set_forkServer(std::shared_ptr<CalexForkServer> server)
+      { MforkServer = server; }
+      /*!
+       * spawn a calex process
+       *
+       * \param param_path Path of the calex parameter file.
+       * \param options Redirection and working directory of the process.
+       *
+       * \return process id of the calex process
+       */
+      pid_t spawn(std::string const& param_path,
+          SpawnOptions const& options=SpawnOptions()) const;
+      /*!
+       * wait for a calex process to terminate
+       *
+       * \param pid Process id returned by CalexLauncher::spawn.
+       * \param usage If not zero the resource usage of the process is stored.
+       *
+       * \return raw wait status of the process
+       */
+      int wait(pid_t const pid, struct rusage* usage=0) const;
+      /*!
+       * spawn a calex process and wait until it terminated
+       *
+       * \param param_path Path of the calex parameter file.
+       *
+       * \return raw wait status of the process
+       */
+      int run(std::string const& param_path) const
+      { return wait(spawn(param_path)); }
+
+    private:
+      //! absolute path of the calex executable
+      std::string Mprogram;
+      //! optional fork server
+      std::shared_ptr<CalexForkServer> MforkServer;
+
+  }; // class CalexLauncher
+
+  /*=========================================================================*/
+  /*!
+   * Spawn a process with \c posix_spawn.
+   *
+   * \c stdin of the process is connected to \c /dev/null. The signal mask
+   * of the process is cleared. The process is placed on the CPU and NUMA
+   * node requested in \c options (see calex::ThreadPlacement).
+   *
+   * \param args Argument vector. The first argument is the path of the
+   * executable.
+   * \param options Redirection, working directory and placement of the
+   * process.
+   *
+   * \return process id of the spawned process
+   */
+  pid_t spawnProcess(std::vector<std::string> const& args,
+      SpawnOptions const& options=SpawnOptions());
+
+  /*-------------------------------------------------------------------------*/
+  /*!
+   * Search an executable in the directories of the \c PATH environment
+   * variable.
+   *
+   * \param program Name of the executable. If \a program contains a slash it
+   * will be returned unchanged.
+   *
+   * \return path of the executable
+   */
+  std::string resolveProgram(std::string const& program);
+
+  /*-------------------------------------------------------------------------*/
+  /*!
+   * Check a raw wait status.
+   *
+   * \return true if the process terminated normally with exit code zero
+   */
+  bool exitedSuccessfully(int const status);
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+#endif // include guard
+
+/* ----- END OF launcher.h  ----- */
@@ -0,0 +1,128 @@
+/*! \file limiter.cc
+ * \brief Implementation of a concurrency limiter for calex processes.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Implementation of a concurrency limiter for calex processes.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ *
+ * ============================================================================
+ */
+
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <sched.h>
+#include <calexxx/limiter.h>
+#include <calexxx/error.h>
+
+namespace calex
+{
+  /*=========================================================================*/
+  ConcurrencyLimiter::ConcurrencyLimiter(unsigned int const slots) :
+    Mslots(slots), Mactive(0), Mwaiting(0)
+  {
+    CALEX_assert(0 < Mslots, "Concurrency limit must be positive.");
+  }
+
+  /*-------------------------------------------------------------------------*/
+  void ConcurrencyLimiter::acquire()
+  {
+    double start = monotonicTime();
+    {
+      boost::unique_lock<boost::mutex> lock(Mmutex);
+      ++Mwaiting;
+      while (Mactive >= Mslots) { Mreleased.wait(lock); }
+      --Mwaiting;
+      ++Mactive;
+    }
+    MwaitStatistics.record(monotonicTime()-start);
+  } // function ConcurrencyLimiter::acquire
+
+  /*-------------------------------------------------------------------------*/
+  void ConcurrencyLimiter::release()
+  {
+    {
+      boost::lock_guard<boost::mutex> lock(Mmutex);
+      CALEX_assert(0 < Mactive, "No slot occupied.");
+      --Mactive;
+    }
+    Mreleased.notify_one();
+  } // function ConcurrencyLimiter::release
+
+  /*-------------------------------------------------------------------------*/
+  unsigned int ConcurrencyLimiter::get_active() const
+  {
+    boost::lock_guard<boost::mutex> lock(Mmutex);
+    return Mactive;
+  }
+
+  /*-------------------------------------------------------------------------*/
+  unsigned int ConcurrencyLimiter::get_waiting() const
+  {
+    boost::lock_guard<boost::mutex> lock(Mmutex);
+    return Mwaiting;
+  }
+
+  /*=========================================================================*/
+  unsigned int availableCores()
+  {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CALEX_assert(0 == sched_getaffinity(0, sizeof(set), &set),
+        "Error while querying CPU affinity.");
+    return CPU_COUNT(&set);
+  }
+
+  /*-------------------------------------------------------------------------*/
+  unsigned int processesFittingMemory(size_t const bytes_per_process)
+  {
+    CALEX_assert(0 < bytes_per_process, "Illegal memory size.");
+    std::ifstream ifs("/proc/meminfo");
+    CALEX_assert(ifs, "Error while reading /proc/meminfo.");
+    std::string line;
+    while (getline(ifs, line))
+    {
+      std::istringstream iss(line);
+      std::string key;
+      size_t kbytes;
+      if (iss >> key >> kbytes && "MemAvailable:" == key)
+      {
+        size_t n = kbytes*1024/bytes_per_process;
+        return n > 0 ? n : 1;
+      }
+    }
+    CALEX_abort("Error while reading /proc/meminfo.");
+  } // function processesFittingMemory
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+/* ----- END OF limiter.cc  ----- */
@@ -0,0 +1,160 @@
+/*! \file limiter.h
+ * \brief Declaration of a concurrency limiter for calex processes.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Declaration of a concurrency limiter for calex processes.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ *
+ * ============================================================================
+ */
+
+
+#include <memory>
+#include <boost/thread.hpp>
+#include <calexxx/watchdog.h>
+#include <calexxx/error.h>
+
+#ifndef _CALEX_LIMITER_H_
+#define _CALEX_LIMITER_H_
+
+namespace calex
+{
+  /*=========================================================================*/
+  /*!
+   * Admission controller for calex processes.
+   *
+   * The number of calex processes running simultaneously otherwise equals
+   * the number of threads liboptimizexx uses to visit the parameter space
+   * grid. The limiter is a counting semaphore which gates spawning calex
+   * such that visitor threads and calex processes can be sized
+   * independently. The limiter may be shared by several
+   * calex::CalexApplication instances.
+   *
+   * The time spent waiting for admission is recorded (see
+   * ConcurrencyLimiter::get_waitStatistics).
+   *
+   * \code
+   * std::shared_ptr<calex::ConcurrencyLimiter> limiter(
+   *     new calex::ConcurrencyLimiter(calex::availableCores()));
+   * app.set_concurrencyLimiter(limiter);
+   * \endcode
+   */
+  class ConcurrencyLimiter
+  {
+    public:
+      /*!
+       * Admission of a single calex process. The slot is released on
+       * destruction.
+       */
+      class Slot
+      {
+        public:
+          //! constructor - waits for admission
+          Slot(ConcurrencyLimiter& limiter) : Mlimiter(limiter)
+          { Mlimiter.acquire(); }
+          //! destructor - releases the slot
+          ~Slot() { Mlimiter.release(); }
+
+        private:
+          //! copying is not allowed
+          Slot(Slot const&);
+          Slot& operator=(Slot const&);
+
+        private:
+          //! limiter the slot belongs to
+          ConcurrencyLimiter& Mlimiter;
+
+      }; // class Slot
+
+    public:
+      /*!
+       * constructor
+       *
+       * \param slots maximum number of simultaneous calex processes
+       */
+      ConcurrencyLimiter(unsigned int const slots);
+      //! wait until a slot is available and occupy it
+      void acquire();
+      //! release an occupied slot
+      void release();
+      //! query function for the maximum number of simultaneous processes
+      unsigned int get_slots() const { return Mslots; }
+      //! query function for the number of occupied slots
+      unsigned int get_active() const;
+      //! query function for the number of threads waiting for admission
+      unsigned int get_waiting() const;
+      //! query function for the statistics of the time waited for admission
+      RunStatistics const& get_waitStatistics() const
+      { return MwaitStatistics; }
+
+    private:
+      //! copying is not allowed
+      ConcurrencyLimiter(ConcurrencyLimiter const&);
+      ConcurrencyLimiter& operator=(ConcurrencyLimiter const&);
+
+    private:
+      //! maximum number of simultaneous processes
+      unsigned int const Mslots;
+      //! number of occupied slots
+      unsigned int Mactive;
+      //! number of threads waiting for admission
+      unsigned int Mwaiting;
+      //! statistics of the time waited for admission
+      RunStatistics MwaitStatistics;
+      //! mutual exclusion variable to guarantee thread safety
+      mutable boost::mutex Mmutex;
+      //! condition signalled when a slot is released
+      boost::condition_variable Mreleased;
+
+  }; // class ConcurrencyLimiter
+
+  /*=========================================================================*/
+  /*!
+   * Number of cores the calling process may run on (see \c
+   * sched_getaffinity).
+   */
+  unsigned int availableCores();
+
+  /*!
+   * Number of calex processes fitting into the memory currently available.
+   *
+   * \param bytes_per_process memory required by a single calex process
+   *
+   * \return number of processes according to \c MemAvailable of \c
+   * /proc/meminfo (at least one)
+   */
+  unsigned int processesFittingMemory(size_t const bytes_per_process);
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+#endif // include guard
+
+/* ----- END OF limiter.h  ----- */
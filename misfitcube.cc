@@ -0,0 +1,313 @@
+/*! \file misfitcube.cc
+ * \brief Implementation of memory mapped misfit cube files.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Implementation of memory mapped misfit cube files.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  Validate the header against the axis records.
+ *
+ * ============================================================================
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <calexxx/misfitcube.h>
+#include <calexxx/error.h>
+
+namespace calex
+{
+  namespace
+  {
+    //! magic number of misfit cube files
+    const char CALEX_CUBE_MAGIC[8] = {'C', 'A', 'L', 'E', 'X', 'C', 'U', 'B'};
+    //! version of the file format
+    const uint32_t CALEX_CUBE_VERSION = 1;
+    //! length of the names of the axes
+    const size_t CALEX_CUBE_NAME = 32;
+
+    //! header of a misfit cube file
+    struct CubeHeader
+    {
+      char Mmagic[8];
+      uint32_t Mversion;
+      uint32_t Mdimensions;
+      uint64_t Moffset;
+      uint64_t Msize;
+    }; // struct CubeHeader
+
+    //! record of an axis
+    struct AxisRecord
+    {
+      char Mname[CALEX_CUBE_NAME];
+      double Mstart;
+      double Mend;
+      double Mdelta;
+      uint32_t Msamples;
+      uint32_t Mreserved;
+    }; // struct AxisRecord
+
+    /*-----------------------------------------------------------------------*/
+    //! size of a page of memory
+    uint64_t pageSize()
+    {
+      return static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    }
+
+    /*-----------------------------------------------------------------------*/
+    //! map a range of a file
+    void* mapRange(int const fd, uint64_t const offset, size_t const length,
+        bool const writable)
+    {
+      void* mapping = mmap(0, length,
+          writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd,
+          offset);
+      CALEX_assert(MAP_FAILED != mapping, "Error while mapping misfit cube.");
+      return mapping;
+    } // function mapRange
+
+  } // namespace (unnamed)
+
+  /*=========================================================================*/
+  MisfitSlice::MisfitSlice(int const fd, uint64_t const offset,
+      size_t const size) : Mmapping(0), Mlength(0), Mdata(0), Msize(size)
+  {
+    // mappings start at page boundaries
+    uint64_t const begin = offset-offset % pageSize();
+    Mlength = offset-begin+size*sizeof(double);
+    Mmapping = mapRange(fd, begin, Mlength, false);
+    Mdata = reinterpret_cast<double const*>(
+        static_cast<char const*>(Mmapping)+(offset-begin));
+  }
+
+  /*-------------------------------------------------------------------------*/
+  MisfitSlice::~MisfitSlice()
+  {
+    munmap(Mmapping, Mlength);
+  }
+
+  /*=========================================================================*/
+  MisfitCube::MisfitCube(int const fd, GridAxes const& axes,
+      uint64_t const offset, bool const writable) : Mfd(fd), Maxes(axes),
+    Moffset(offset), Mwritable(writable), Mdata(0)
+  {
+    Mdata = static_cast<double*>(mapRange(Mfd, Moffset,
+          size()*sizeof(double), Mwritable));
+  }
+
+  /*-------------------------------------------------------------------------*/
+  MisfitCube::~MisfitCube()
+  {
+    if (Mdata) { munmap(Mdata, size()*sizeof(double)); }
+    close(Mfd);
+  }
+
+  /*-------------------------------------------------------------------------*/
+  std::shared_ptr<MisfitCube> MisfitCube::create(std::string const& path,
+      GridAxes const& axes)
+  {
+    CubeHeader header;
+    memcpy(header.Mmagic, CALEX_CUBE_MAGIC, sizeof(header.Mmagic));
+    header.Mversion = CALEX_CUBE_VERSION;
+    header.Mdimensions = axes.get_dimensions();
+    uint64_t const records = sizeof(CubeHeader)+
+      header.Mdimensions*sizeof(AxisRecord);
+    // the data starts at a page boundary such that slices can be mapped
+    header.Moffset = (records+pageSize()-1)/pageSize()*pageSize();
+    header.Msize = axes.size();
+
+    std::vector<char> buffer(header.Moffset, 0);
+    memcpy(&buffer[0], &header, sizeof(header));
+    for (unsigned int i = 0; i < header.Mdimensions; ++i)
+    {
+      AxisRecord record;
+      memset(&record, 0, sizeof(record));
+      strncpy(record.Mname, axes[i].Mname.c_str(), CALEX_CUBE_NAME-1);
+      record.Mstart = axes[i].Mstart;
+      record.Mend = axes[i].Mend;
+      record.Mdelta = axes[i].Mdelta;
+      record.Msamples = axes[i].Msamples;
+      memcpy(&buffer[sizeof(header)+i*sizeof(record)], &record,
+          sizeof(record));
+    }
+
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC,
+        0644);
+    CALEX_assert(-1 != fd, "Error while creating misfit cube.");
+    if (0 != ftruncate(fd, header.Moffset+header.Msize*sizeof(double)) ||
+        static_cast<ssize_t>(buffer.size()) !=
+        pwrite(fd, &buffer[0], buffer.size(), 0))
+    {
+      close(fd);
+      CALEX_abort("Error while writing misfit cube.");
+    }
+    std::shared_ptr<MisfitCube> cube(
+        new MisfitCube(fd, axes, header.Moffset, true));
+    std::fill(cube->Mdata, cube->Mdata+cube->size(),
+        std::numeric_limits<double>::quiet_NaN());
+    return cube;
+  } // function MisfitCube::create
+
+  /*-------------------------------------------------------------------------*/
+  std::shared_ptr<MisfitCube> MisfitCube::open(std::string const& path)
+  {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    CALEX_assert(-1 != fd, "Error while opening misfit cube.");
+    CubeHeader header;
+    struct stat st;
+    // the axis records must fit before the data which must fit into the
+    // file
+    if (sizeof(header) != pread(fd, &header, sizeof(header), 0) ||
+        0 != memcmp(header.Mmagic, CALEX_CUBE_MAGIC, sizeof(header.Mmagic))
+        || CALEX_CUBE_VERSION != header.Mversion || 0 != fstat(fd, &st) ||
+        0 != header.Moffset % pageSize() ||
+        header.Moffset < sizeof(header) ||
+        0 == header.Mdimensions || header.Mdimensions >
+        (header.Moffset-sizeof(header))/sizeof(AxisRecord) ||
+        static_cast<uint64_t>(st.st_size) < header.Moffset ||
+        header.Msize >
+        (static_cast<uint64_t>(st.st_size)-header.Moffset)/sizeof(double))
+    {
+      close(fd);
+      CALEX_abort("Invalid misfit cube.");
+    }
+    GridAxes::Taxes axes(header.Mdimensions);
+    // number of nodes spanned by the axes
+    uint64_t nodes = 1;
+    for (unsigned int i = 0; i < header.Mdimensions; ++i)
+    {
+      AxisRecord record;
+      if (sizeof(record) != pread(fd, &record, sizeof(record),
+            sizeof(header)+i*sizeof(record)) ||
+          ! (record.Mdelta > 0.) || 0 == record.Msamples ||
+          record.Msamples > header.Msize/nodes)
+      {
+        close(fd);
+        CALEX_abort("Invalid misfit cube.");
+      }
+      nodes *= record.Msamples;
+      record.Mname[CALEX_CUBE_NAME-1] = '\0';
+      axes[i].Mname = record.Mname;
+      axes[i].Mstart = record.Mstart;
+      axes[i].Mend = record.Mend;
+      axes[i].Mdelta = record.Mdelta;
+      axes[i].Msamples = record.Msamples;
+    }
+    // the mapping is sized by the axes
+    GridAxes grid(axes);
+    if (grid.size() != header.Msize)
+    {
+      close(fd);
+      CALEX_abort("Invalid misfit cube.");
+    }
+    return std::shared_ptr<MisfitCube>(
+        new MisfitCube(fd, grid, header.Moffset, false));
+  } // function MisfitCube::open
+
+  /*-------------------------------------------------------------------------*/
+  void MisfitCube::store(size_t const index, double const rms)
+  {
+    CALEX_assert(Mwritable, "Misfit cube opened for reading only.");
+    CALEX_assert(index < size(), "Coordinate index out of range.");
+    Mdata[index] = rms;
+  } // function MisfitCube::store
+
+  /*-------------------------------------------------------------------------*/
+  void MisfitCube::sync()
+  {
+    if (! Mwritable) { return; }
+    CALEX_assert(0 == msync(Mdata, size()*sizeof(double), MS_SYNC),
+        "Error while writing misfit cube.");
+  } // function MisfitCube::sync
+
+  /*-------------------------------------------------------------------------*/
+  double MisfitCube::at(size_t const index) const
+  {
+    CALEX_assert(index < size(), "Coordinate index out of range.");
+    return Mdata[index];
+  } // function MisfitCube::at
+
+  /*-------------------------------------------------------------------------*/
+  std::vector<double> MisfitCube::plane(unsigned int const row,
+      unsigned int const column, std::vector<unsigned int> const& indexes)
+    const
+  {
+    CALEX_assert(row < Maxes.get_dimensions() &&
+        column < Maxes.get_dimensions() && row != column &&
+        indexes.size() == Maxes.get_dimensions(),
+        "Invalid dimensions of misfit surface.");
+    size_t base = 0;
+    for (unsigned int i = 0; i < indexes.size(); ++i)
+    {
+      if (i == row || i == column) { continue; }
+      CALEX_assert(indexes[i] < Maxes[i].Msamples,
+          "Coordinate index out of range.");
+      base += indexes[i]*Maxes.get_stride(i);
+    }
+    size_t const rows = Maxes[row].Msamples;
+    size_t const columns = Maxes[column].Msamples;
+    std::vector<double> values(rows*columns);
+    for (size_t i = 0; i < rows; ++i)
+    {
+      for (size_t j = 0; j < columns; ++j)
+      {
+        values[i*columns+j] = Mdata[base+i*Maxes.get_stride(row)+
+          j*Maxes.get_stride(column)];
+      }
+    }
+    return values;
+  } // function MisfitCube::plane
+
+  /*-------------------------------------------------------------------------*/
+  std::shared_ptr<MisfitSlice> MisfitCube::slice(
+      std::vector<unsigned int> const& leading) const
+  {
+    CALEX_assert(! leading.empty() &&
+        leading.size() <= Maxes.get_dimensions(),
+        "Invalid dimensions of misfit slice.");
+    size_t begin = 0;
+    for (unsigned int i = 0; i < leading.size(); ++i)
+    {
+      CALEX_assert(leading[i] < Maxes[i].Msamples,
+          "Coordinate index out of range.");
+      begin += leading[i]*Maxes.get_stride(i);
+    }
+    size_t const count = Maxes.get_stride(leading.size()-1);
+    return std::shared_ptr<MisfitSlice>(new MisfitSlice(Mfd,
+          Moffset+begin*sizeof(double), count));
+  } // function MisfitCube::slice
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+/* ----- END OF misfitcube.cc  ----- */
@@ -0,0 +1,244 @@
+/*! \file misfitcube.h
+ * \brief Declaration of memory mapped misfit cube files.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Declaration of memory mapped misfit cube files.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ *
+ * ============================================================================
+ */
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <limits>
+#include <stdint.h>
+#include <calexxx/gridaxes.h>
+#include <calexxx/resultdata.h>
+#include <calexxx/error.h>
+
+#ifndef _CALEX_MISFITCUBE_H_
+#define _CALEX_MISFITCUBE_H_
+
+namespace calex
+{
+  /*=========================================================================*/
+  /*!
+   * Contiguous part of a misfit cube mapped into memory.
+   *
+   * Created by MisfitCube::slice. Only the pages of the slice are mapped.
+   */
+  class MisfitSlice
+  {
+    public:
+      //! destructor
+      ~MisfitSlice();
+      //! query function for the number of values
+      size_t size() const { return Msize; }
+      //! query function for the values
+      double const* data() const { return Mdata; }
+      //! query function for a value
+      double operator[](size_t const i) const { return Mdata[i]; }
+
+    private:
+      //! constructor
+      MisfitSlice(int const fd, uint64_t const offset, size_t const size);
+      //! copying is not allowed
+      MisfitSlice(MisfitSlice const&);
+      MisfitSlice& operator=(MisfitSlice const&);
+
+    private:
+      //! mapping
+      void* Mmapping;
+      //! length of the mapping
+      size_t Mlength;
+      //! values of the slice within the mapping
+      double const* Mdata;
+      //! number of values
+      size_t Msize;
+
+      friend class MisfitCube;
+
+  }; // class MisfitSlice
+
+  /*=========================================================================*/
+  /*!
+   * N-dimensional misfit cube file.
+   *
+   * The RMS of every node of the parameter space is stored as a binary
+   * array of \c double values at the node's coordinate index (see
+   * calex::GridAxes), i.e. the last dimension varies fastest. The file is
+   * mapped into memory while it is written such that every node lands at
+   * its offset directly during the sweep; gathering the results afterwards
+   * is not necessary. Nodes not computed hold \c NaN.
+   *
+   * File layout (host byte order):
+   *  - header of 32 bytes: magic \c CALEXCUB, format version (\c uint32),
+   *    number of dimensions (\c uint32), offset of the data (\c uint64),
+   *    number of values (\c uint64)
+   *  - one record of 64 bytes per dimension: name of the grid system
+   *    parameter (32 characters, zero padded), start, end and delta
+   *    (\c double), number of coordinates (\c uint32), reserved (\c uint32)
+   *  - data starting at a multiple of the page size
+   *
+   * Readers map the file on demand: MisfitCube::at and MisfitCube::plane
+   * only touch the pages of the values requested and MisfitCube::slice maps
+   * a contiguous slice without the remaining cube.
+   *
+   * Usage:
+   * \code
+   * std::shared_ptr<calex::MisfitCube> cube(calex::MisfitCube::create(
+   *       "misfit.cube", calex::GridAxes(config)));
+   * app.set_misfitCube(cube);
+   * grid->accept(app);
+   * cube->sync();
+   *
+   * std::shared_ptr<calex::MisfitCube> reader(
+   *     calex::MisfitCube::open("misfit.cube"));
+   * // per x dmp surface with the remaining coordinates fixed
+   * std::vector<double> surface(reader->plane(1, 0, fixed));
+   * \endcode
+   */
+  class MisfitCube
+  {
+    public:
+      /*!
+       * create a misfit cube file
+       *
+       * \param path path of the file (replaced if it exists)
+       * \param axes axes of the parameter space
+       *
+       * \return writable misfit cube
+       */
+      static std::shared_ptr<MisfitCube> create(std::string const& path,
+          GridAxes const& axes);
+      /*!
+       * open a misfit cube file for reading
+       *
+       * \param path path of the file
+       *
+       * \return read-only misfit cube
+       */
+      static std::shared_ptr<MisfitCube> open(std::string const& path);
+      //! destructor
+      ~MisfitCube();
+      //! query function for the axes
+      GridAxes const& get_axes() const { return Maxes; }
+      //! query function for the number of values
+      size_t size() const { return Maxes.size(); }
+      /*!
+       * store the RMS of a node (thread safe for distinct nodes)
+       *
+       * \param index coordinate index of the node
+       * \param rms RMS of the node
+       */
+      void store(size_t const index, double const rms);
+      /*!
+       * store the result data of a node
+       *
+       * \param coordinates coordinates of the node
+       * \param result result data of the node (\c NaN if not computed)
+       *
+       * \return false if the coordinates are not within the parameter space
+       */
+      template <typename Ctype>
+      bool store(std::vector<Ctype> const& coordinates,
+          CalexResult const& result);
+      //! write modified pages to the file
+      void sync();
+      /*!
+       * query function for the RMS of a node
+       *
+       * \param index coordinate index of the node
+       */
+      double at(size_t const index) const;
+      /*!
+       * extract a two-dimensional surface
+       *
+       * \param row dimension varying along the rows
+       * \param column dimension varying along the columns
+       * \param indexes coordinate indexes (positions on the axes) of all
+       * dimensions; those of \a row and \a column are ignored
+       *
+       * \return values of the surface, \a column varying fastest
+       */
+      std::vector<double> plane(unsigned int const row,
+          unsigned int const column,
+          std::vector<unsigned int> const& indexes) const;
+      /*!
+       * map a contiguous slice of the cube
+       *
+       * \param leading positions on the axes of the leading dimensions
+       *
+       * \return values of all nodes sharing the leading coordinates
+       */
+      std::shared_ptr<MisfitSlice> slice(
+          std::vector<unsigned int> const& leading) const;
+
+    private:
+      //! constructor
+      MisfitCube(int const fd, GridAxes const& axes, uint64_t const offset,
+          bool const writable);
+      //! copying is not allowed
+      MisfitCube(MisfitCube const&);
+      MisfitCube& operator=(MisfitCube const&);
+
+    private:
+      //! file descriptor
+      int Mfd;
+      //! axes of the parameter space
+      GridAxes Maxes;
+      //! offset of the data
+      uint64_t Moffset;
+      //! cube is writable
+      bool Mwritable;
+      //! mapping of the data
+      double* Mdata;
+
+  }; // class MisfitCube
+
+  /*=========================================================================*/
+  template <typename Ctype>
+  bool MisfitCube::store(std::vector<Ctype> const& coordinates,
+      CalexResult const& result)
+  {
+    size_t const index = Maxes.index(coordinates);
+    if (GridAxes::npos == index) { return false; }
+    store(index, result.isComputed() ? result.get_rms() :
+        std::numeric_limits<double>::quiet_NaN());
+    return true;
+  } // function template MisfitCube::store
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+#endif // include guard
+
+/* ----- END OF misfitcube.h  ----- */
@@ -0,0 +1,178 @@
+/*! \file outputchannel.cc
+ * \brief Implementation of channels transferring calex output to the
+ * library.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Implementation of channels transferring calex output to the
+ * library.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  Parse calex output by calex::ResultParser.
+ * 17/10/2026   V0.3  OutputChannel::read reports output lacking the block of
+ *                    final system parameters.
+ *
+ * ============================================================================
+ */
+
+#include <sstream>
+#include <cerrno>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <calexxx/outputchannel.h>
+#include <calexxx/resultparser.h>
+#include <calexxx/error.h>
+
+namespace calex
+{
+  namespace
+  {
+    //! size of chunks read from a pipe
+    const size_t CALEX_PIPE_CHUNK = 65536;
+  } // namespace (unnamed)
+
+  /*=========================================================================*/
+  OutputChannel::OutputChannel(EoutputMode const mode) : Mmode(mode),
+    Mfd(-1), MwriteFd(-1)
+  { }
+
+  /*-------------------------------------------------------------------------*/
+  OutputChannel::~OutputChannel()
+  {
+    if (-1 != Mfd) { close(Mfd); }
+    if (-1 != MwriteFd) { close(MwriteFd); }
+  }
+
+  /*-------------------------------------------------------------------------*/
+  void OutputChannel::prepare(std::string const& out_path,
+      SpawnOptions& options)
+  {
+    MoutPath = out_path;
+    Mbuffer.clear();
+    if (StdoutPipe == Mmode)
+    {
+      int fds[2];
+      CALEX_assert(0 == pipe2(fds, O_CLOEXEC), "Error while creating pipe.");
+      Mfd = fds[0];
+      MwriteFd = fds[1];
+      options.MstdoutFd = MwriteFd;
+      // discard the *.out file calex writes itself
+      unlink(MoutPath.c_str());
+      CALEX_assert(0 == symlink("/dev/null", MoutPath.c_str()),
+          "Error while creating link for calex output file.");
+    } else
+    if (OutMemfd == Mmode)
+    {
+      Mfd = memfd_create("calex-out", MFD_CLOEXEC);
+      CALEX_assert(-1 != Mfd, "Error while creating memfd.");
+      std::ostringstream oss;
+      oss << "/proc/" << getpid() << "/fd/" << Mfd;
+      unlink(MoutPath.c_str());
+      CALEX_assert(0 == symlink(oss.str().c_str(), MoutPath.c_str()),
+          "Error while creating link for calex output file.");
+    }
+  } // function OutputChannel::prepare
+
+  /*-------------------------------------------------------------------------*/
+  void OutputChannel::spawned()
+  {
+    // only calex must hold the write end such that EOF is detected
+    if (-1 != MwriteFd)
+    {
+      close(MwriteFd);
+      MwriteFd = -1;
+    }
+  } // function OutputChannel::spawned
+
+  /*-------------------------------------------------------------------------*/
+  bool OutputChannel::drainSome()
+  {
+    if (StdoutPipe != Mmode || -1 == Mfd) { return false; }
+    char chunk[CALEX_PIPE_CHUNK];
+    ssize_t n;
+    do
+    {
+      n = ::read(Mfd, chunk, sizeof(chunk));
+    } while (-1 == n && EINTR == errno);
+    if (n > 0)
+    {
+      Mbuffer.append(chunk, n);
+      return true;
+    }
+    // a non-blocking descriptor without data
+    if (-1 == n && EAGAIN == errno) { return true; }
+    return false;
+  } // function OutputChannel::drainSome
+
+  /*-------------------------------------------------------------------------*/
+  void OutputChannel::drain()
+  {
+    while (drainSome()) { }
+  } // function OutputChannel::drain
+
+  /*-------------------------------------------------------------------------*/
+  bool OutputChannel::read(CalexResult& result)
+  {
+    ResultParser& parser(ResultParser::local());
+    if (OutFile == Mmode)
+    {
+      if (! parser.parseFile(MoutPath)) { return false; }
+      parser.get_result(result);
+      return parser.found();
+    }
+    if (OutMemfd == Mmode)
+    {
+      struct stat st;
+      CALEX_assert(0 == fstat(Mfd, &st), "Error while querying memfd.");
+      Mbuffer.resize(st.st_size);
+      if (st.st_size > 0)
+      {
+        CALEX_assert(st.st_size == pread(Mfd, &Mbuffer[0], st.st_size, 0),
+            "Error while reading memfd.");
+      }
+    }
+    if (Mbuffer.empty()) { return false; }
+    parser.parse(Mbuffer.data(), Mbuffer.size());
+    parser.get_result(result);
+    return parser.found();
+  } // function OutputChannel::read
+
+  /*-------------------------------------------------------------------------*/
+  void OutputChannel::cleanup()
+  {
+    if (! MoutPath.empty()) { unlink(MoutPath.c_str()); }
+    if (-1 != Mfd) { close(Mfd); Mfd = -1; }
+    if (-1 != MwriteFd) { close(MwriteFd); MwriteFd = -1; }
+  } // function OutputChannel::cleanup
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+/* ----- END OF outputchannel.cc  ----- */
@@ -0,0 +1,163 @@
+/*! \file outputchannel.h
+ * \brief Declaration of channels transferring calex output to the library.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Declaration of channels transferring calex output to the library.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ *
+ * ============================================================================
+ */
+
+#include <string>
+#include <calexxx/launcher.h>
+#include <calexxx/resultdata.h>
+#include <calexxx/error.h>
+
+#ifndef _CALEX_OUTPUTCHANNEL_H_
+#define _CALEX_OUTPUTCHANNEL_H_
+
+namespace calex
+{
+  //! ways calex output is transferred to the library
+  enum EoutputMode
+  {
+    OutFile,    //!< calex writes its \c *.out file which is read afterwards
+    StdoutPipe, //!< calex output is drained from a pipe connected to stdout
+    OutMemfd    //!< calex writes its \c *.out file into an anonymous memfd
+  }; // enum EoutputMode
+
+  /*=========================================================================*/
+  /*!
+   * Channel transferring the output of a single calex run.
+   *
+   * Usually calex writes a \c *.out file which is reopened and parsed by
+   * calex::CalexResult afterwards. On network-mounted working directories
+   * every file operation is expensive. Therefore besides of
+   * calex::OutFile the following modes are provided:
+   *  - calex::StdoutPipe: \c stdout of calex is connected to a pipe which is
+   *    drained into memory and parsed directly. The \c *.out file calex
+   *    writes itself is replaced by a symbolic link to \c /dev/null.
+   *  - calex::OutMemfd: The \c *.out file is replaced by a symbolic link to
+   *    \c /proc/<pid>/fd/<N> of an anonymous memory file (\c memfd_create).
+   *    calex writes into memory and the result is parsed from there. Use
+   *    this mode if calex' \c stdout differs from the \c *.out file.
+   *
+   * Usage:
+   * \code
+   * OutputChannel channel(StdoutPipe);
+   * channel.prepare(out_path, options);
+   * pid_t pid = launcher.spawn(param_path, options);
+   * channel.spawned();
+   * channel.drain();
+   * int status = launcher.wait(pid);
+   * channel.read(result);
+   * channel.cleanup();
+   * \endcode
+   * OutputChannel::drain must be called before waiting for the process,
+   * since calex blocks as soon as the pipe is full.
+   */
+  class OutputChannel
+  {
+    public:
+      /*!
+       * constructor
+       *
+       * \param mode output mode
+       */
+      OutputChannel(EoutputMode const mode=OutFile);
+      //! destructor
+      ~OutputChannel();
+      //! query function for the output mode
+      EoutputMode get_mode() const { return Mmode; }
+      /*!
+       * prepare the channel before calex is spawned
+       *
+       * \param out_path Path of the \c *.out file calex is going to write.
+       * \param options Spawn options which are adjusted according to the
+       * output mode.
+       */
+      void prepare(std::string const& out_path, SpawnOptions& options);
+      //! release descriptors the host does not need after spawning calex
+      void spawned();
+      /*!
+       * query function for the descriptor the output can be read from while
+       * calex is running
+       *
+       * \return read end of the pipe if calex::StdoutPipe is in use, -1
+       * otherwise
+       */
+      int get_fd() const { return StdoutPipe == Mmode ? Mfd : -1; }
+      /*!
+       * append data read from OutputChannel::get_fd to the channel's buffer
+       *
+       * \return false on end of file
+       */
+      bool drainSome();
+      //! read calex output until end of file (calex::StdoutPipe only)
+      void drain();
+      /*!
+       * parse the calex output
+       *
+       * \param result result data to be filled
+       *
+       * \return false if no output was available or the output lacks the
+       * block of final system parameters
+       */
+      bool read(CalexResult& result);
+      //! query function for the output collected in memory
+      std::string const& get_buffer() const { return Mbuffer; }
+      //! remove the \c *.out file (or link) and close all descriptors
+      void cleanup();
+
+    private:
+      //! copying is not allowed
+      OutputChannel(OutputChannel const&);
+      OutputChannel& operator=(OutputChannel const&);
+
+    private:
+      //! output mode
+      EoutputMode Mmode;
+      //! path of the calex *.out file (or link)
+      std::string MoutPath;
+      //! read end of the pipe or memfd
+      int Mfd;
+      //! write end of the pipe
+      int MwriteFd;
+      //! output collected in memory
+      std::string Mbuffer;
+
+  }; // class OutputChannel
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+#endif // include guard
+
+/* ----- END OF outputchannel.h  ----- */
@@ -0,0 +1,250 @@
+/*! \file placement.cc
+ * \brief Implementation of CPU and NUMA placement of calex processes.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Implementation of CPU and NUMA placement of calex processes.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ *
+ * ============================================================================
+ */
+
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <map>
+#include <tuple>
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <cctype>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/syscall.h>
+#include <calexxx/placement.h>
+#include <calexxx/error.h>
+
+namespace calex
+{
+  namespace
+  {
+    //! memory policy modes (see set_mempolicy(2))
+    const int CALEX_MPOL_PREFERRED = 1;
+    //! maximum number of NUMA nodes supported
+    const unsigned long CALEX_MAX_NODES = 1024;
+    //! number of bits of an unsigned long
+    const unsigned long CALEX_LONG_BITS = 8*sizeof(unsigned long);
+
+    //! topology of a single CPU
+    struct CpuTopology
+    {
+      int Mcpu;
+      int Mnode;
+      int Mpackage;
+      int Mcore;
+      //! index among the siblings of its physical core
+      int Msibling;
+      //! index of its physical core within its NUMA node
+      int McoreRank;
+    }; // struct CpuTopology
+
+    /*-----------------------------------------------------------------------*/
+    //! read an integer from a sysfs file (-1 if not available)
+    int readSysfs(int const cpu, char const* name)
+    {
+      std::ostringstream oss;
+      oss << "/sys/devices/system/cpu/cpu" << cpu << "/topology/" << name;
+      std::ifstream ifs(oss.str().c_str());
+      int value = -1;
+      if (! (ifs >> value)) { return -1; }
+      return value;
+    }
+
+    /*-----------------------------------------------------------------------*/
+    //! NUMA node of a CPU (-1 if not available)
+    int readNode(int const cpu)
+    {
+      std::ostringstream oss;
+      oss << "/sys/devices/system/cpu/cpu" << cpu;
+      DIR* dir = opendir(oss.str().c_str());
+      if (! dir) { return -1; }
+      int node = -1;
+      struct dirent* entry;
+      while (0 != (entry = readdir(dir)))
+      {
+        if (0 == strncmp(entry->d_name, "node", 4) &&
+            isdigit(entry->d_name[4]))
+        {
+          node = atoi(entry->d_name+4);
+          break;
+        }
+      }
+      closedir(dir);
+      return node;
+    }
+
+  } // namespace (unnamed)
+
+  /*=========================================================================*/
+  CpuPlacement::CpuPlacement(EplacementPolicy const policy,
+      bool const local_memory, std::ostream* log) : Mpolicy(policy),
+    MlocalMemory(local_memory), Mlog(log), Mcount(0)
+  {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CALEX_assert(0 == sched_getaffinity(0, sizeof(set), &set),
+        "Error while querying CPU affinity.");
+
+    // collect topology of the CPUs available
+    std::vector<CpuTopology> cpus;
+    std::map<std::tuple<int, int, int>, int> siblings;
+    std::map<std::tuple<int, int, int>, int> core_ranks;
+    std::map<int, int> cores_per_node;
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+    {
+      if (! CPU_ISSET(cpu, &set)) { continue; }
+      CpuTopology topo;
+      topo.Mcpu = cpu;
+      topo.Mnode = readNode(cpu);
+      topo.Mpackage = readSysfs(cpu, "physical_package_id");
+      topo.Mcore = readSysfs(cpu, "core_id");
+      std::tuple<int, int, int> core(topo.Mnode, topo.Mpackage, topo.Mcore);
+      topo.Msibling = siblings[core]++;
+      if (! core_ranks.count(core))
+      {
+        core_ranks[core] = cores_per_node[topo.Mnode]++;
+      }
+      topo.McoreRank = core_ranks[core];
+      cpus.push_back(topo);
+
+      if (static_cast<int>(Mnodes.size()) <= cpu) { Mnodes.resize(cpu+1, -1); }
+      Mnodes[cpu] = topo.Mnode;
+    }
+    CALEX_assert(! cpus.empty(), "No CPU available.");
+
+    // order according to policy
+    if (Compact == Mpolicy)
+    {
+      std::sort(cpus.begin(), cpus.end(),
+          [](CpuTopology const& a, CpuTopology const& b)
+          {
+            return std::make_tuple(a.Mnode, a.Mpackage, a.Mcore, a.Mcpu) <
+              std::make_tuple(b.Mnode, b.Mpackage, b.Mcore, b.Mcpu);
+          });
+    } else
+    if (Spread == Mpolicy)
+    {
+      std::sort(cpus.begin(), cpus.end(),
+          [](CpuTopology const& a, CpuTopology const& b)
+          {
+            return std::make_tuple(a.Msibling, a.McoreRank, a.Mnode,
+                a.Mpackage, a.Mcpu) < std::make_tuple(b.Msibling,
+                b.McoreRank, b.Mnode, b.Mpackage, b.Mcpu);
+          });
+    }
+    for (auto cit(cpus.cbegin()); cit != cpus.cend(); ++cit)
+    {
+      Morder.push_back(cit->Mcpu);
+    }
+  } // constructor CpuPlacement::CpuPlacement
+
+  /*-------------------------------------------------------------------------*/
+  void CpuPlacement::assign(SpawnOptions& options)
+  {
+    int cpu = Morder[Mcount++ % Morder.size()];
+    options.Mcpu = cpu;
+    options.MmemNode = MlocalMemory ? get_node(cpu) : -1;
+  } // function CpuPlacement::assign
+
+  /*-------------------------------------------------------------------------*/
+  void CpuPlacement::log(pid_t const pid, SpawnOptions const& options,
+      double const seconds) const
+  {
+    if (! Mlog) { return; }
+    std::ostringstream oss;
+    oss << "calex pid " << pid << " cpu " << options.Mcpu << " node "
+      << get_node(options.Mcpu) << " memory node " << options.MmemNode
+      << " wall time " << seconds << " s";
+    boost::lock_guard<boost::mutex> lock(Mmutex);
+    *Mlog << oss.str() << std::endl;
+  } // function CpuPlacement::log
+
+  /*-------------------------------------------------------------------------*/
+  int CpuPlacement::get_node(int const cpu) const
+  {
+    if (cpu < 0 || cpu >= static_cast<int>(Mnodes.size())) { return -1; }
+    return Mnodes[cpu];
+  }
+
+  /*=========================================================================*/
+  ThreadPlacement::ThreadPlacement(int const cpu, int const node) :
+    Maffinity(false), Mmempolicy(false), MsavedMode(0),
+    MsavedNodes(CALEX_MAX_NODES/CALEX_LONG_BITS, 0)
+  {
+    if (cpu >= 0)
+    {
+      CALEX_assert(0 == sched_getaffinity(0, sizeof(MsavedCpus), &MsavedCpus),
+          "Error while querying CPU affinity.");
+      cpu_set_t set;
+      CPU_ZERO(&set);
+      CPU_SET(cpu, &set);
+      CALEX_assert(0 == sched_setaffinity(0, sizeof(set), &set),
+          "Error while setting CPU affinity.");
+      Maffinity = true;
+    }
+    if (node >= 0 && node < static_cast<int>(CALEX_MAX_NODES))
+    {
+      CALEX_assert(0 == syscall(SYS_get_mempolicy, &MsavedMode,
+            &MsavedNodes[0], CALEX_MAX_NODES, 0, 0),
+          "Error while querying memory policy.");
+      std::vector<unsigned long> mask(MsavedNodes.size(), 0);
+      mask[node/CALEX_LONG_BITS] |= 1UL << (node % CALEX_LONG_BITS);
+      CALEX_assert(0 == syscall(SYS_set_mempolicy, CALEX_MPOL_PREFERRED,
+            &mask[0], CALEX_MAX_NODES),
+          "Error while setting memory policy.");
+      Mmempolicy = true;
+    }
+  } // constructor ThreadPlacement::ThreadPlacement
+
+  /*-------------------------------------------------------------------------*/
+  ThreadPlacement::~ThreadPlacement()
+  {
+    if (Mmempolicy)
+    {
+      syscall(SYS_set_mempolicy, MsavedMode, &MsavedNodes[0],
+          CALEX_MAX_NODES);
+    }
+    if (Maffinity) { sched_setaffinity(0, sizeof(MsavedCpus), &MsavedCpus); }
+  } // destructor ThreadPlacement::~ThreadPlacement
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+/* ----- END OF placement.cc  ----- */
@@ -0,0 +1,195 @@
+/*! \file placement.h
+ * \brief Declaration of CPU and NUMA placement of calex processes.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Declaration of CPU and NUMA placement of calex processes.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ *
+ * ============================================================================
+ */
+
+
+#include <iostream>
+#include <vector>
+#include <atomic>
+#include <sched.h>
+#include <sys/types.h>
+#include <boost/thread.hpp>
+#include <calexxx/launcher.h>
+#include <calexxx/error.h>
+
+#ifndef _CALEX_PLACEMENT_H_
+#define _CALEX_PLACEMENT_H_
+
+namespace calex
+{
+  //! policies placing calex processes on CPUs
+  enum EplacementPolicy
+  {
+    RoundRobin, //!< cycle through the CPUs in ascending order
+    Compact,    //!< fill a NUMA node (and its cores' siblings) first
+    Spread      //!< alternate NUMA nodes and physical cores
+  }; // enum EplacementPolicy
+
+  /*=========================================================================*/
+  /*!
+   * Placement of calex processes on CPUs and NUMA nodes.
+   *
+   * Without placement calex processes migrate freely between cores and
+   * sockets. The placement pins every calex process to a single CPU
+   * selected from the CPUs the caller is allowed to run on according to a
+   * calex::EplacementPolicy. Optionally the process' memory policy prefers
+   * the NUMA node the CPU belongs to. The topology is read from \c
+   * /sys/devices/system/cpu once on construction.
+   *
+   * The placement is passed to the process by means of calex::SpawnOptions
+   * (see SpawnOptions::Mcpu and SpawnOptions::MmemNode). Every placement
+   * may be logged together with the run time of the process:
+   * \code
+   * calex::CpuPlacement placement(calex::Spread, true, &std::clog);
+   * calex::SpawnOptions options;
+   * placement.assign(options);
+   * pid_t pid = launcher.spawn(param_path, options);
+   * // ...
+   * placement.log(pid, options, seconds);
+   * \endcode
+   */
+  class CpuPlacement
+  {
+    public:
+      /*!
+       * constructor
+       *
+       * \param policy placement policy
+       * \param local_memory prefer memory of the NUMA node of the CPU
+       * \param log Stream placements are logged to. If zero placements are
+       * not logged.
+       */
+      CpuPlacement(EplacementPolicy const policy,
+          bool const local_memory=false, std::ostream* log=0);
+      /*!
+       * select the CPU (and NUMA node) of the next calex process
+       *
+       * \param options spawn options to be adjusted
+       */
+      void assign(SpawnOptions& options);
+      /*!
+       * log the placement of a calex process
+       *
+       * \param pid process id of calex
+       * \param options spawn options the process was spawned with
+       * \param seconds wall-clock time of the process
+       */
+      void log(pid_t const pid, SpawnOptions const& options,
+          double const seconds) const;
+      //! query function for the placement policy
+      EplacementPolicy get_policy() const { return Mpolicy; }
+      //! query function for the order CPUs are assigned in
+      std::vector<int> const& get_order() const { return Morder; }
+      /*!
+       * query function for the NUMA node of a CPU
+       *
+       * \param cpu CPU number
+       *
+       * \return NUMA node or -1 if unknown
+       */
+      int get_node(int const cpu) const;
+
+    private:
+      //! copying is not allowed
+      CpuPlacement(CpuPlacement const&);
+      CpuPlacement& operator=(CpuPlacement const&);
+
+    private:
+      //! placement policy
+      EplacementPolicy Mpolicy;
+      //! prefer memory of the NUMA node of the CPU
+      bool MlocalMemory;
+      //! log stream
+      std::ostream* Mlog;
+      //! order CPUs are assigned in
+      std::vector<int> Morder;
+      //! NUMA node by CPU number
+      std::vector<int> Mnodes;
+      //! number of placements so far
+      std::atomic<unsigned long> Mcount;
+      //! mutual exclusion variable protecting the log stream
+      mutable boost::mutex Mmutex;
+
+  }; // class CpuPlacement
+
+  /*=========================================================================*/
+  /*!
+   * Temporary CPU affinity and memory policy of the calling thread.
+   *
+   * Processes spawned by a thread inherit its CPU affinity and memory
+   * policy. calex::spawnProcess therefore applies the placement requested
+   * in calex::SpawnOptions to the calling thread while spawning. The
+   * previous settings are restored on destruction.
+   */
+  class ThreadPlacement
+  {
+    public:
+      /*!
+       * constructor
+       *
+       * \param cpu CPU the thread is pinned to (ignored if negative)
+       * \param node NUMA node preferred for memory allocations (ignored if
+       * negative)
+       */
+      ThreadPlacement(int const cpu, int const node);
+      //! destructor - restores the previous settings
+      ~ThreadPlacement();
+
+    private:
+      //! copying is not allowed
+      ThreadPlacement(ThreadPlacement const&);
+      ThreadPlacement& operator=(ThreadPlacement const&);
+
+    private:
+      //! flag if the CPU affinity was changed
+      bool Maffinity;
+      //! previous CPU affinity
+      cpu_set_t MsavedCpus;
+      //! flag if the memory policy was changed
+      bool Mmempolicy;
+      //! previous memory policy mode
+      int MsavedMode;
+      //! previous memory policy node mask
+      std::vector<unsigned long> MsavedNodes;
+
+  }; // class ThreadPlacement
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+#endif // include guard
+
+/* ----- END OF placement.h  ----- */
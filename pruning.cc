@@ -0,0 +1,134 @@
+/*! \file pruning.cc
+ * \brief Implementation of early termination of hopeless calex runs.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Implementation of early termination of hopeless calex runs.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ *
+ * ============================================================================
+ */
+
+#include <cstdlib>
+#include <limits>
+#include <calexxx/pruning.h>
+#include <calexxx/error.h>
+
+namespace calex
+{
+  /*=========================================================================*/
+  BestRms::BestRms() : Mvalue(std::numeric_limits<double>::infinity())
+  { }
+
+  /*-------------------------------------------------------------------------*/
+  bool BestRms::offer(double const rms)
+  {
+    double current = Mvalue.load(std::memory_order_relaxed);
+    while (rms < current)
+    {
+      if (Mvalue.compare_exchange_weak(current, rms,
+            std::memory_order_relaxed)) { return true; }
+    }
+    return false;
+  }
+
+  /*-------------------------------------------------------------------------*/
+  void BestRms::reset()
+  {
+    Mvalue.store(std::numeric_limits<double>::infinity());
+  }
+
+  /*=========================================================================*/
+  IterationMonitor::IterationMonitor(PruningPolicy const& policy,
+      BestRms const& best) : Mpolicy(policy), Mbest(best), Mpos(0),
+    MinTable(false), Miter(0), Mrms(0), Mprune(false)
+  { }
+
+  /*-------------------------------------------------------------------------*/
+  bool IterationMonitor::feed(std::string const& output)
+  {
+    size_t eol;
+    while (! Mprune && std::string::npos != (eol = output.find('\n', Mpos)))
+    {
+      parseLine(output.data()+Mpos, output.data()+eol);
+      Mpos = eol+1;
+    }
+    return Mprune;
+  } // function IterationMonitor::feed
+
+  /*-------------------------------------------------------------------------*/
+  bool IterationMonitor::watch(OutputChannel& channel)
+  {
+    while (channel.drainSome())
+    {
+      if (feed(channel.get_buffer())) { return true; }
+    }
+    return false;
+  } // function IterationMonitor::watch
+
+  /*-------------------------------------------------------------------------*/
+  void IterationMonitor::parseLine(char const* begin, char const* end)
+  {
+    while (begin != end && (' ' == *begin || '\t' == *begin)) { ++begin; }
+    if (begin == end) { return; }
+    std::string line(begin, end);
+    if (! MinTable)
+    {
+      // header of the iteration table
+      if (0 == line.compare(0, 4, "iter") &&
+          std::string::npos != line.find("RMS")) { MinTable = true; }
+      return;
+    }
+    if (0 == line.compare(0, 23, "final system parameters"))
+    {
+      MinTable = false;
+      return;
+    }
+    // iteration lines start with the iteration number followed by the RMS;
+    // uncertainty lines start with "+-"
+    char* pos;
+    long iter = strtol(line.c_str(), &pos, 10);
+    if (pos == line.c_str() || iter < 0) { return; }
+    char* rms_end;
+    double rms = strtod(pos, &rms_end);
+    if (rms_end == pos) { return; }
+    Miter = iter;
+    Mrms = rms;
+
+    if (Mpolicy.isActive() && Miter >= Mpolicy.MminIter &&
+        Mrms > Mpolicy.Mratio*Mbest.get())
+    {
+      Mprune = true;
+    }
+  } // function IterationMonitor::parseLine
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+/* ----- END OF pruning.cc  ----- */
@@ -0,0 +1,191 @@
+/*! \file pruning.h
+ * \brief Declaration of early termination of hopeless calex runs.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Declaration of early termination of hopeless calex runs.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ *
+ * ============================================================================
+ */
+
+
+#include <string>
+#include <atomic>
+#include <calexxx/outputchannel.h>
+#include <calexxx/error.h>
+
+#ifndef _CALEX_PRUNING_H_
+#define _CALEX_PRUNING_H_
+
+namespace calex
+{
+  /*=========================================================================*/
+  /*!
+   * Best RMS found so far within a parameter space grid.
+   *
+   * The value is shared between all threads visiting the grid and updated
+   * without locking.
+   */
+  class BestRms
+  {
+    public:
+      //! constructor
+      BestRms();
+      //! query function for the best RMS (infinity if not available yet)
+      double get() const { return Mvalue.load(std::memory_order_relaxed); }
+      /*!
+       * offer a RMS of a computed node
+       *
+       * \param rms root mean square of the computed node
+       *
+       * \return true if \c rms is the new best RMS
+       */
+      bool offer(double const rms);
+      //! forget the best RMS
+      void reset();
+
+    private:
+      //! copying is not allowed
+      BestRms(BestRms const&);
+      BestRms& operator=(BestRms const&);
+
+    private:
+      //! best RMS so far
+      std::atomic<double> Mvalue;
+
+  }; // class BestRms
+
+  /*=========================================================================*/
+  /*!
+   * Policy deciding when a calex run is terminated early.
+   *
+   * A run is pruned as soon as it reached PruningPolicy::MminIter iterations
+   * and its current RMS still is greater than PruningPolicy::Mratio times the
+   * best RMS found so far. A ratio of zero disables pruning.
+   */
+  struct PruningPolicy
+  {
+    /*!
+     * constructor
+     *
+     * \param ratio RMS ratio threshold
+     * \param min_iter number of iterations calex is allowed at least
+     */
+    PruningPolicy(double const ratio=0., unsigned int const min_iter=3) :
+      Mratio(ratio), MminIter(min_iter)
+    { }
+    //! query function if pruning is enabled
+    bool isActive() const { return Mratio > 0.; }
+    //! RMS ratio threshold
+    double Mratio;
+    //! number of iterations calex is allowed at least
+    unsigned int MminIter;
+
+  }; // struct PruningPolicy
+
+  /*=========================================================================*/
+  /*!
+   * Streaming monitor of the iteration lines calex prints while running.
+   *
+   * calex prints a table containing the RMS of every iteration, e.g.
+   * \code
+   *  iter         RMS         amp         del         per         dmp
+   *
+   *     0    0.014384  -41.500000    0.010000  120.000000    0.707000
+   *                +-    5.100000    0.001000    1.000000    0.010000
+   *     1    0.005623    0.105681   -0.000009   -0.003371    0.008314
+   * \endcode
+   * long before the final system parameters are reported. The monitor
+   * consumes the output incrementally and decides according to a
+   * calex::PruningPolicy if the run is hopeless compared to the best RMS
+   * found so far.
+   */
+  class IterationMonitor
+  {
+    public:
+      /*!
+       * constructor
+       *
+       * \param policy pruning policy
+       * \param best best RMS found so far
+       */
+      IterationMonitor(PruningPolicy const& policy, BestRms const& best);
+      /*!
+       * consume complete lines of calex output not consumed yet
+       *
+       * \param output calex output collected so far
+       *
+       * \return true if the run should be pruned
+       */
+      bool feed(std::string const& output);
+      /*!
+       * read from a calex::StdoutPipe channel until end of file or until the
+       * run should be pruned
+       *
+       * \param channel output channel of the running calex process
+       *
+       * \return true if the run should be pruned
+       */
+      bool watch(OutputChannel& channel);
+      //! query function if the run should be pruned
+      bool prune() const { return Mprune; }
+      //! query function for the last iteration reported
+      unsigned int get_iter() const { return Miter; }
+      //! query function for the RMS of the last iteration reported
+      double get_rms() const { return Mrms; }
+
+    private:
+      //! parse a single line of calex output
+      void parseLine(char const* begin, char const* end);
+
+    private:
+      //! pruning policy
+      PruningPolicy Mpolicy;
+      //! best RMS found so far
+      BestRms const& Mbest;
+      //! position of the first character not consumed yet
+      size_t Mpos;
+      //! flag if the iteration table is being read
+      bool MinTable;
+      //! last iteration reported
+      unsigned int Miter;
+      //! RMS of the last iteration reported
+      double Mrms;
+      //! flag if the run should be pruned
+      bool Mprune;
+
+  }; // class IterationMonitor
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+#endif // include guard
+
+/* ----- END OF pruning.h  ----- */
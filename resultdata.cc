@@ -36,6 +36,17 @@
  *                      an outputstream
  * 14/06/2012   V0.3    Bug fix parsing a calex *.out file - amp and del system
  *                      parameters from now on are deprecated
+ * 17/10/2026   V0.4    store result status and exit status of the calex
+ *                      process
+ * 17/10/2026   V0.5    result status for calex runs terminated early
+ * 17/10/2026   V0.6    result status for calex runs exceeding their time
+ *                      limits
+ * 17/10/2026   V0.7    read the QUAD line following the final system
+ *                      parameters
+ * 17/10/2026   V0.8    interned names of the system parameters and values
+ *                      stored inline
+ * 17/10/2026   V0.9    binary result files; lines written without flushing
+ *                      the stream
  * 
  * ============================================================================
  */
@@ -45,16 +56,225 @@
 #include <iomanip>
 #include <algorithm>
 #include <iterator>
+#include <memory>
+#include <cstring>
+#include <cmath>
+#include <fstream>
+#include <sys/wait.h>
+#include <boost/thread.hpp>
 #include <calexxx/resultdata.h>
 #include <calexxx/error.h>
 
 namespace calex
 {
+  namespace
+  {
+    //! schemas interned so far
+    std::vector<std::unique_ptr<ResultSchema>>& schemas()
+    {
+      static std::vector<std::unique_ptr<ResultSchema>> registry;
+      return registry;
+    }
+
+    //! mutex protecting the schemas interned
+    boost::mutex& schemaMutex()
+    {
+      static boost::mutex mutex;
+      return mutex;
+    }
+
+  } // namespace (unnamed)
+
+  /*=========================================================================*/
+  ResultSchema const* ResultSchema::intern(
+      std::vector<std::string> const& names)
+  {
+    boost::mutex::scoped_lock lock(schemaMutex());
+    std::vector<std::unique_ptr<ResultSchema>>& registry(schemas());
+    for (auto cit(registry.cbegin()); cit != registry.cend(); ++cit)
+    {
+      if ((*cit)->Mnames == names) { return cit->get(); }
+    }
+    registry.push_back(std::unique_ptr<ResultSchema>(new ResultSchema(names)));
+    return registry.back().get();
+  } // function ResultSchema::intern
+
+  /*-------------------------------------------------------------------------*/
+  ResultSchema const* ResultSchema::intern(Tname const* names,
+      size_t const size)
+  {
+    {
+      boost::mutex::scoped_lock lock(schemaMutex());
+      std::vector<std::unique_ptr<ResultSchema>>& registry(schemas());
+      for (auto cit(registry.cbegin()); cit != registry.cend(); ++cit)
+      {
+        if ((*cit)->matches(names, size)) { return cit->get(); }
+      }
+    }
+    std::vector<std::string> strings;
+    strings.reserve(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+      strings.push_back(std::string(names[i].first, names[i].second));
+    }
+    return intern(strings);
+  } // function ResultSchema::intern
+
+  /*-------------------------------------------------------------------------*/
+  bool ResultSchema::matches(Tname const* names, size_t const size) const
+  {
+    if (size != Mnames.size()) { return false; }
+    for (size_t i = 0; i < size; ++i)
+    {
+      if (Mnames[i].size() != names[i].second ||
+          0 != Mnames[i].compare(0, names[i].second, names[i].first,
+            names[i].second))
+      {
+        return false;
+      }
+    }
+    return true;
+  } // function ResultSchema::matches
+
+  /*=========================================================================*/
+  CalexResult::CalexResult(unsigned int const iter, double const rms, 
+      TsystemParameters const params) : Mstatus(Computed), MexitStatus(0),
+    Miter(iter), Mrms(rms), MquadCalls(0), Mconvergence(UnknownConvergence),
+    Mschema(0), Mvalues(Minline)
+  {
+    std::vector<std::string> names;
+    std::vector<double> values;
+    names.reserve(params.size());
+    values.reserve(params.size());
+    for (auto cit(params.cbegin()); cit != params.cend(); ++cit)
+    {
+      names.push_back(cit->first);
+      values.push_back(cit->second);
+    }
+    if (! params.empty()) { assign(ResultSchema::intern(names), &values[0]); }
+  }
+
+  /*-------------------------------------------------------------------------*/
+  CalexResult::CalexResult(unsigned int const iter, double const rms,
+      ResultSchema const* schema, double const* values) : Mstatus(Computed),
+    MexitStatus(0), Miter(iter), Mrms(rms), MquadCalls(0),
+    Mconvergence(UnknownConvergence), Mschema(0), Mvalues(Minline)
+  {
+    assign(schema, values);
+  }
+
+  /*-------------------------------------------------------------------------*/
+  CalexResult::CalexResult(CalexResult const& rhs) : Mstatus(rhs.Mstatus),
+    MexitStatus(rhs.MexitStatus), Miter(rhs.Miter), Mrms(rhs.Mrms),
+    MquadCalls(rhs.MquadCalls), Mconvergence(rhs.Mconvergence), Mschema(0),
+    Mvalues(Minline)
+  {
+    assign(rhs.Mschema, rhs.Mvalues);
+  }
+
+  /*-------------------------------------------------------------------------*/
+  CalexResult::CalexResult(CalexResult&& rhs) : Mstatus(rhs.Mstatus),
+    MexitStatus(rhs.MexitStatus), Miter(rhs.Miter), Mrms(rhs.Mrms),
+    MquadCalls(rhs.MquadCalls), Mconvergence(rhs.Mconvergence), Mschema(0),
+    Mvalues(Minline)
+  {
+    steal(rhs);
+  }
+
+  /*-------------------------------------------------------------------------*/
+  CalexResult& CalexResult::operator=(CalexResult const& rhs)
+  {
+    if (this == &rhs) { return *this; }
+    Mstatus = rhs.Mstatus;
+    MexitStatus = rhs.MexitStatus;
+    Miter = rhs.Miter;
+    Mrms = rhs.Mrms;
+    MquadCalls = rhs.MquadCalls;
+    Mconvergence = rhs.Mconvergence;
+    assign(rhs.Mschema, rhs.Mvalues);
+    return *this;
+  }
+
   /*-------------------------------------------------------------------------*/
-  std::vector<std::pair<std::string, double>> const&
-    CalexResult::get_systemParameters() const
+  CalexResult& CalexResult::operator=(CalexResult&& rhs)
   {
-    return MsystemParameters;
+    if (this == &rhs) { return *this; }
+    Mstatus = rhs.Mstatus;
+    MexitStatus = rhs.MexitStatus;
+    Miter = rhs.Miter;
+    Mrms = rhs.Mrms;
+    MquadCalls = rhs.MquadCalls;
+    Mconvergence = rhs.Mconvergence;
+    steal(rhs);
+    return *this;
+  }
+
+  /*-------------------------------------------------------------------------*/
+  void CalexResult::assign(ResultSchema const* schema, double const* values)
+  {
+    size_t const size = schema ? schema->size() : 0;
+    // heap memory is reused if it fits
+    if (size > CALEX_RESULT_INLINE && size > get_size())
+    {
+      release();
+      Mvalues = new double[size];
+    } else
+    if (size <= CALEX_RESULT_INLINE)
+    {
+      release();
+    }
+    Mschema = schema;
+    if (size) { memcpy(Mvalues, values, size*sizeof(double)); }
+  } // function CalexResult::assign
+
+  /*-------------------------------------------------------------------------*/
+  void CalexResult::steal(CalexResult& rhs)
+  {
+    if (rhs.Mvalues == rhs.Minline)
+    {
+      assign(rhs.Mschema, rhs.Mvalues);
+    } else
+    {
+      release();
+      Mschema = rhs.Mschema;
+      Mvalues = rhs.Mvalues;
+      rhs.Mvalues = rhs.Minline;
+    }
+    rhs.Mschema = 0;
+  } // function CalexResult::steal
+
+  /*-------------------------------------------------------------------------*/
+  void CalexResult::release()
+  {
+    if (Mvalues != Minline) { delete[] Mvalues; }
+    Mvalues = Minline;
+  } // function CalexResult::release
+
+  /*-------------------------------------------------------------------------*/
+  CalexResult::TsystemParameters CalexResult::get_systemParameters() const
+  {
+    TsystemParameters params;
+    params.reserve(get_size());
+    for (size_t i = 0; i < get_size(); ++i)
+    {
+      params.push_back(std::make_pair((*Mschema)[i], Mvalues[i]));
+    }
+    return params;
+  }
+
+  /*-------------------------------------------------------------------------*/
+  void CalexResult::set_exitStatus(int const status)
+  {
+    MexitStatus = status;
+    if (! WIFEXITED(status) || 0 != WEXITSTATUS(status)) { Mstatus = Failed; }
+  }
+
+  /*-------------------------------------------------------------------------*/
+  void CalexResult::set_pruned(unsigned int const iter, double const rms)
+  {
+    Mstatus = Pruned;
+    Miter = iter;
+    Mrms = rms;
   }
 
   /*-------------------------------------------------------------------------*/
@@ -63,19 +283,11 @@ namespace calex
     std::ostringstream oss;
     oss << std::right << std::setw(5) << Miter
       << std::setw(12) << std::right << std::fixed << Mrms;
-#if ((__GNUC__ <= 4) && (__GNUC_MINOR__ < 6))
-    for (auto cit(MsystemParameters.cbegin()); cit != MsystemParameters.cend();
-      ++cit)
+    for (size_t i = 0; i < get_size(); ++i)
     {
-      oss << std::setw(12) << std::right << std::fixed << cit->second;
+      oss << std::setw(12) << std::right << std::fixed << Mvalues[i];
     }
-#else
-    for (auto x : MsystemParameters)
-    {
-      oss << std::setw(12) << std::right << std::fixed << x.second;
-    }
-#endif
-    os << oss.str() << std::endl;
+    os << oss.str() << '\n';
   } // function CalexResult::writeLine
 
   /*-------------------------------------------------------------------------*/
@@ -83,19 +295,11 @@ namespace calex
   {
     os << std::setw(5) << std::right << "iter"
       << std::setw(12) << std::right << "RMS";
-#if ((__GNUC__ <= 4) && (__GNUC_MINOR__ < 6))
-    for (auto cit(MsystemParameters.cbegin()); cit != MsystemParameters.cend();
-      ++cit)
-    {
-      os << std::setw(12) << std::right << std::fixed << cit->first;
-    }
-#else
-    for (auto x : MsystemParameters)
+    for (size_t i = 0; i < get_size(); ++i)
     {
-      os << std::setw(12) << std::right << std::fixed << x.first;
+      os << std::setw(12) << std::right << std::fixed << (*Mschema)[i];
     }
-#endif
-    os << std::endl;
+    os << '\n';
   } // function CalexResult::writeHeaderInfo
 
   /*-------------------------------------------------------------------------*/
@@ -132,14 +336,32 @@ namespace calex
         Mrms = vals[1];
 
         // add remaining result parameters
-        for (size_t i=2; i < vals.size(); ++i)
+        if (vals.size() > 2)
+        {
+          assign(ResultSchema::intern(std::vector<std::string>(
+                  names.begin()+2, names.end())), &vals[2]);
+        }
+
+        // QUAD line reporting convergence
+        while (getline(is >> std::ws, line))
         {
-          MsystemParameters.push_back(std::make_pair(names[i], vals[i]));
+          if (line.substr(0, 12) != "QUAD called ") { continue; }
+          std::istringstream iss(line.substr(12));
+          iss >> MquadCalls;
+          if (line.find("not converged") != std::string::npos)
+          {
+            Mconvergence = NotConverged;
+          } else
+          if (line.find("converged") != std::string::npos)
+          {
+            Mconvergence = Converged;
+          }
+          break;
         }
         break;
       }
     }
-    Mcomputed = true;
+    Mstatus = Computed;
   } // function CalexResult::read
 
   /*-------------------------------------------------------------------------*/
@@ -148,35 +370,19 @@ namespace calex
     os << " final system parameters:\n" << std::endl
       << std::setw(5) << std::right << "iter"
       << std::setw(12) << std::right << "RMS";
-#if ((__GNUC__ <= 4) && (__GNUC_MINOR__ < 6))
-    for (auto cit(MsystemParameters.cbegin()); cit != MsystemParameters.cend();
-      ++cit)
+    for (size_t i = 0; i < get_size(); ++i)
     {
-      os << std::setw(12) << std::right << cit->first;
+      os << std::setw(12) << std::right << (*Mschema)[i];
     }
-#else
-    for (auto x : MsystemParameters)
-    {
-      os << std::setw(12) << std::right << x.first;
-    }
-#endif
     os << std::endl;
 
     std::stringstream ss;
     ss << std::right << std::setw(5) << Miter
       << std::setw(12) << std::right << std::fixed << Mrms;
-#if ((__GNUC__ <= 4) && (__GNUC_MINOR__ < 6))
-    for (auto cit(MsystemParameters.cbegin()); cit != MsystemParameters.cend();
-      ++cit)
-    {
-      ss << std::setw(12) << std::right << std::fixed << cit->second;
-    }
-#else
-    for (auto x : MsystemParameters)
+    for (size_t i = 0; i < get_size(); ++i)
     {
-      ss << std::setw(12) << std::right << std::fixed << x.second;
+      ss << std::setw(12) << std::right << std::fixed << Mvalues[i];
     }
-#endif
     os << ss.str() << std::endl;
   } // function CalexResult::write
 
@@ -196,6 +402,294 @@ namespace calex
 
   /*-------------------------------------------------------------------------*/
 
+  /*=========================================================================*/
+  namespace
+  {
+    //! magic of a binary result file
+    char const RESULT_FILE_MAGIC[8] = {'C','A','L','E','X','R','E','S'};
+    //! magic of the footer of a binary result file
+    char const RESULT_FILE_END[8] = {'C','A','L','E','X','E','N','D'};
+    //! version of the binary result file format
+    const uint32_t RESULT_FILE_VERSION = 1;
+    //! size of the header of a binary result file
+    const size_t RESULT_FILE_HEADER = 24;
+    //! size of the fixed part of a record
+    const size_t RESULT_FILE_RECORD = 24;
+    //! size of the footer of a binary result file
+    const size_t RESULT_FILE_FOOTER = 16;
+
+    //! copy a value of type Ctype from a byte buffer
+    template <typename Ctype>
+    Ctype load(char const* data)
+    {
+      Ctype value;
+      memcpy(&value, data, sizeof(Ctype));
+      return value;
+    }
+
+    //! copy a value of type Ctype into a byte buffer
+    template <typename Ctype>
+    void stash(char* data, Ctype const value)
+    {
+      memcpy(data, &value, sizeof(Ctype));
+    }
+
+  } // namespace (unnamed)
+
+  /*-------------------------------------------------------------------------*/
+  ResultFileWriter::ResultFileWriter(std::ostream& os) : Mos(os), Mschema(0),
+    Mstarted(false), Mclosed(false), Moffset(0), Mforeign(0)
+  { }
+
+  /*-------------------------------------------------------------------------*/
+  ResultFileWriter::~ResultFileWriter()
+  {
+    // destructors must not throw
+    try { close(); } catch (...) { }
+  }
+
+  /*-------------------------------------------------------------------------*/
+  void ResultFileWriter::put(void const* data, size_t const size)
+  {
+    Mos.write(static_cast<char const*>(data), size);
+    CALEX_assert(Mos.good(), "Error while writing binary result file.");
+    Moffset += size;
+  } // function ResultFileWriter::put
+
+  /*-------------------------------------------------------------------------*/
+  void ResultFileWriter::writeHeader(ResultSchema const* schema)
+  {
+    Mschema = schema;
+    Mforeign = schema;
+    std::vector<std::string> const empty;
+    std::vector<std::string> const& names(
+        Mschema ? Mschema->get_names() : empty);
+    uint32_t schema_size = 0;
+    for (auto cit(names.cbegin()); cit != names.cend(); ++cit)
+    {
+      schema_size += sizeof(uint32_t)+cit->size();
+    }
+    schema_size = (schema_size+7) & ~7u;
+    Mrecord.assign(RESULT_FILE_RECORD+names.size()*sizeof(double), 0);
+
+    char header[RESULT_FILE_HEADER];
+    memcpy(header, RESULT_FILE_MAGIC, sizeof(RESULT_FILE_MAGIC));
+    stash<uint32_t>(header+8, RESULT_FILE_VERSION);
+    stash<uint32_t>(header+12, names.size());
+    stash<uint32_t>(header+16, Mrecord.size());
+    stash<uint32_t>(header+20, RESULT_FILE_HEADER+schema_size);
+    put(header, sizeof(header));
+
+    std::string block;
+    for (auto cit(names.cbegin()); cit != names.cend(); ++cit)
+    {
+      char length[sizeof(uint32_t)];
+      stash<uint32_t>(length, cit->size());
+      block.append(length, sizeof(length));
+      block.append(*cit);
+    }
+    block.resize(schema_size, '\0');
+    put(block.data(), block.size());
+    Mstarted = true;
+  } // function ResultFileWriter::writeHeader
+
+  /*-------------------------------------------------------------------------*/
+  void ResultFileWriter::write(CalexResult const& result,
+      std::string const& source)
+  {
+    CALEX_assert(! Mclosed, "Binary result file already closed.");
+    if (! Mstarted) { writeHeader(result.get_schema()); }
+
+    char* record = &Mrecord[0];
+    memset(record, 0, RESULT_FILE_RECORD);
+    stash<double>(record, result.get_rms());
+    stash<uint32_t>(record+8, result.get_iter());
+    stash<uint32_t>(record+12, result.get_quadCalls());
+    record[16] = static_cast<char>(result.get_status());
+    record[17] = static_cast<char>(result.get_convergence());
+
+    size_t const size = Mschema ? Mschema->size() : 0;
+    char* values = record+RESULT_FILE_RECORD;
+    if (result.get_schema() == Mschema)
+    {
+      if (size) { memcpy(values, result.get_values(), size*sizeof(double)); }
+    } else
+    {
+      // assign values of a differing schema by name
+      if (result.get_schema() != Mforeign)
+      {
+        Mforeign = result.get_schema();
+        Mcolumns.assign(size, -1);
+        for (size_t j = 0; Mforeign && j < Mforeign->size(); ++j)
+        {
+          for (size_t k = 0; k < size; ++k)
+          {
+            if ((*Mforeign)[j] == (*Mschema)[k]) { Mcolumns[k] = j; }
+          }
+        }
+      }
+      for (size_t k = 0; k < size; ++k)
+      {
+        stash<double>(values+k*sizeof(double), -1 == Mcolumns[k] ? NAN :
+            result.get_values()[Mcolumns[k]]);
+      }
+    }
+    put(record, Mrecord.size());
+    Msources.push_back(source);
+  } // function ResultFileWriter::write
+
+  /*-------------------------------------------------------------------------*/
+  void ResultFileWriter::close()
+  {
+    if (Mclosed) { return; }
+    if (! Mstarted) { writeHeader(0); }
+    Mclosed = true;
+    uint64_t const sources = Moffset;
+    std::string block;
+    for (auto cit(Msources.cbegin()); cit != Msources.cend(); ++cit)
+    {
+      char length[sizeof(uint32_t)];
+      stash<uint32_t>(length, cit->size());
+      block.append(length, sizeof(length));
+      block.append(*cit);
+    }
+    char footer[RESULT_FILE_FOOTER];
+    stash<uint64_t>(footer, sources);
+    memcpy(footer+8, RESULT_FILE_END, sizeof(RESULT_FILE_END));
+    block.append(footer, sizeof(footer));
+    put(block.data(), block.size());
+    Mos.flush();
+  } // function ResultFileWriter::close
+
+  /*=========================================================================*/
+  ResultFileReader::ResultFileReader(std::string const& path) : Mschema(0),
+    Mfirst(0), MrecordSize(0), Msize(0)
+  {
+    std::ifstream ifs(path.c_str(), std::ios::binary);
+    CALEX_assert(ifs.good(), "Error while opening binary result file.");
+    ifs.seekg(0, std::ios::end);
+    size_t const file_size = ifs.tellg();
+    ifs.seekg(0, std::ios::beg);
+    Mdata.resize(file_size);
+    if (file_size) { ifs.read(&Mdata[0], file_size); }
+    CALEX_assert(ifs.good(), "Error while reading binary result file.");
+
+    char const* data = Mdata.data();
+    CALEX_assert(file_size >= RESULT_FILE_HEADER &&
+        0 == memcmp(data, RESULT_FILE_MAGIC, sizeof(RESULT_FILE_MAGIC)),
+        "Not a binary result file.");
+    CALEX_assert(RESULT_FILE_VERSION == load<uint32_t>(data+8),
+        "Unsupported version of binary result file.");
+    size_t const size = load<uint32_t>(data+12);
+    MrecordSize = load<uint32_t>(data+16);
+    Mfirst = load<uint32_t>(data+20);
+    CALEX_assert(MrecordSize == RESULT_FILE_RECORD+size*sizeof(double) &&
+        Mfirst <= file_size, "Corrupt binary result file.");
+
+    // schema block
+    std::vector<ResultSchema::Tname> names;
+    size_t pos = RESULT_FILE_HEADER;
+    for (size_t j = 0; j < size; ++j)
+    {
+      CALEX_assert(pos+sizeof(uint32_t) <= Mfirst,
+          "Corrupt binary result file.");
+      size_t const length = load<uint32_t>(data+pos);
+      pos += sizeof(uint32_t);
+      CALEX_assert(pos+length <= Mfirst, "Corrupt binary result file.");
+      names.push_back(ResultSchema::Tname(data+pos, length));
+      pos += length;
+    }
+    if (size) { Mschema = ResultSchema::intern(&names[0], size); }
+
+    // footer (missing if the file was not closed)
+    size_t end = file_size;
+    bool closed = false;
+    if (file_size >= Mfirst+RESULT_FILE_FOOTER &&
+        0 == memcmp(data+file_size-sizeof(RESULT_FILE_END), RESULT_FILE_END,
+          sizeof(RESULT_FILE_END)))
+    {
+      uint64_t const sources = load<uint64_t>(data+file_size-
+          RESULT_FILE_FOOTER);
+      CALEX_assert(sources >= Mfirst && sources <= file_size-
+          RESULT_FILE_FOOTER, "Corrupt binary result file.");
+      end = sources;
+      closed = true;
+    }
+    Msize = (end-Mfirst)/MrecordSize;
+
+    if (closed)
+    {
+      size_t const limit = file_size-RESULT_FILE_FOOTER;
+      pos = end;
+      Msources.reserve(Msize);
+      for (size_t i = 0; i < Msize; ++i)
+      {
+        CALEX_assert(pos+sizeof(uint32_t) <= limit,
+            "Corrupt binary result file.");
+        size_t const length = load<uint32_t>(data+pos);
+        pos += sizeof(uint32_t);
+        CALEX_assert(pos+length <= limit, "Corrupt binary result file.");
+        Msources.push_back(std::string(data+pos, length));
+        pos += length;
+      }
+    }
+  }
+
+  /*-------------------------------------------------------------------------*/
+  char const* ResultFileReader::record(size_t const i) const
+  {
+    CALEX_assert(i < Msize, "Index of binary result record out of range.");
+    return Mdata.data()+Mfirst+i*MrecordSize;
+  } // function ResultFileReader::record
+
+  /*-------------------------------------------------------------------------*/
+  void ResultFileReader::read(size_t const i, CalexResult& result) const
+  {
+    char const* rec = record(i);
+    size_t const size = Mschema ? Mschema->size() : 0;
+    std::vector<double> values(size);
+    if (size)
+    {
+      memcpy(&values[0], rec+RESULT_FILE_RECORD, size*sizeof(double));
+    }
+    result = CalexResult(load<uint32_t>(rec+8), load<double>(rec), Mschema,
+        size ? &values[0] : 0);
+    result.set_convergence(load<uint32_t>(rec+12),
+        static_cast<Econvergence>(rec[17]));
+    result.Mstatus = static_cast<EresultStatus>(rec[16]);
+  } // function ResultFileReader::read
+
+  /*-------------------------------------------------------------------------*/
+  double ResultFileReader::get_rms(size_t const i) const
+  {
+    return load<double>(record(i));
+  } // function ResultFileReader::get_rms
+
+  /*-------------------------------------------------------------------------*/
+  std::string const& ResultFileReader::get_source(size_t const i) const
+  {
+    CALEX_assert(i < Msources.size(),
+        "Sources of binary result file not available.");
+    return Msources[i];
+  } // function ResultFileReader::get_source
+
+  /*-------------------------------------------------------------------------*/
+  std::vector<double> ResultFileReader::column(size_t const j) const
+  {
+    CALEX_assert(Mschema && j < Mschema->size(),
+        "Index of system parameter out of range.");
+    std::vector<double> values;
+    values.reserve(Msize);
+    size_t const offset = RESULT_FILE_RECORD+j*sizeof(double);
+    for (size_t i = 0; i < Msize; ++i)
+    {
+      values.push_back(load<double>(record(i)+offset));
+    }
+    return values;
+  } // function ResultFileReader::column
+
+  /*-------------------------------------------------------------------------*/
+
 } // namespace calex
 
 /* ----- END OF resultdata.cc  ----- */
@@ -36,6 +36,16 @@
  *                      an outputstream
  * 14/06/2012   V0.3    Bug fix parsing a calex *.out file - amp and del system
  *                      parameters from now on are deprecated
+ * 17/10/2026   V0.4    store result status and exit status of the calex
+ *                      process
+ * 17/10/2026   V0.5    result status for calex runs terminated early
+ * 17/10/2026   V0.6    result status for calex runs exceeding their time
+ *                      limits
+ * 17/10/2026   V0.7    number of QUAD calls and convergence of the calex
+ *                      iteration
+ * 17/10/2026   V0.8    interned names of the system parameters and values
+ *                      stored inline
+ * 17/10/2026   V0.9    binary result files
  * 
  * ============================================================================
  */
@@ -44,6 +54,8 @@
 #include <vector>
 #include <string>
 #include <utility>
+#include <cstddef>
+#include <stdint.h>
 #include <calexxx/error.h>
 
 #ifndef _CALEX_RESULTDATA_H_
@@ -51,12 +63,103 @@
 
 namespace calex
 {
+  //! status of a calex result
+  enum EresultStatus
+  {
+    NotComputed,  //!< calex had not been run yet
+    Computed,     //!< result data successfully read
+    Failed,       //!< calex process terminated abnormally
+    Pruned,       //!< calex run terminated early since it was hopeless
+    TimedOut      //!< calex run exceeded its time limits
+  }; // enum EresultStatus
+
+  //! convergence of the calex iteration
+  enum Econvergence
+  {
+    UnknownConvergence, //!< QUAD line not found in the calex output
+    Converged,          //!< calex reported convergence
+    NotConverged        //!< calex stopped without convergence (e.g. maxit)
+  }; // enum Econvergence
+
+  //! number of system parameter values stored within calex::CalexResult
+  const size_t CALEX_RESULT_INLINE = 6;
+
+  /*=========================================================================*/
+  /*!
+   * Names of the system parameters of calex result data.
+   *
+   * All results of a configuration report the same system parameters. Their
+   * names therefore are interned once by ResultSchema::intern and results
+   * only refer to the shared schema. Schemas are never released; only a few
+   * distinct ones exist during a program run.
+   */
+  class ResultSchema
+  {
+    public:
+      //! name of a system parameter referring to a buffer
+      typedef std::pair<char const*, size_t> Tname;
+
+    public:
+      /*!
+       * fetch the schema of the names passed (thread safe)
+       *
+       * \param names names of the system parameters
+       *
+       * \return schema valid until the program terminates
+       */
+      static ResultSchema const* intern(std::vector<std::string> const& names);
+      /*!
+       * fetch the schema of the names passed (thread safe)
+       *
+       * \param names names of the system parameters referring to a buffer
+       * \param size number of names
+       *
+       * \return schema valid until the program terminates
+       */
+      static ResultSchema const* intern(Tname const* names, size_t const size);
+      //! query function for the number of system parameters
+      size_t size() const { return Mnames.size(); }
+      //! query function for the name of a system parameter
+      std::string const& operator[](size_t const i) const
+      { return Mnames[i]; }
+      //! query function for the names of the system parameters
+      std::vector<std::string> const& get_names() const { return Mnames; }
+      //! check if the schema consists of the \a size names passed
+      bool matches(Tname const* names, size_t const size) const;
+
+    private:
+      //! constructor
+      explicit ResultSchema(std::vector<std::string> const& names) :
+        Mnames(names)
+      { }
+      //! copying is not allowed
+      ResultSchema(ResultSchema const&);
+      ResultSchema& operator=(ResultSchema const&);
+
+    private:
+      //! names of the system parameters
+      std::vector<std::string> Mnames;
+
+  }; // class ResultSchema
+
+  /*=========================================================================*/
   /*!
    * Datatype to store the result data after calculating the residuals with
    * Erhard Wielandt's calex program.
    *
-   * \todo \c sub and \c til parameters were not printed yet.
+   * \note calex does not print the \c sub and \c til parameters within the
+   * block of final system parameters. Their start values and the complete
+   * calex output (iteration history, uncertainties, poles) are provided by
+   * calex::CalexOutput.
+   *
+   * From V0.7 the number of QUAD calls and the convergence reported by calex
+   * are stored, too.
    *
+   * From V0.8 the names of the system parameters are not stored by each
+   * result anymore. A result refers to an interned calex::ResultSchema and
+   * stores up to calex::CALEX_RESULT_INLINE values inline. Copying such a
+   * result does not allocate heap memory; results with more values are
+   * moved without copying their values.
    */
   class CalexResult
   {
@@ -64,23 +167,101 @@ namespace calex
       typedef std::vector<std::pair<std::string, double>> TsystemParameters;
     public:
       //! constructor
-      CalexResult() : Mcomputed(false), Miter(0), Mrms(0)
+      CalexResult() : Mstatus(NotComputed), MexitStatus(0), Miter(0), Mrms(0),
+        MquadCalls(0), Mconvergence(UnknownConvergence), Mschema(0),
+        Mvalues(Minline)
       { }
-      //! constructor
+      /*!
+       * constructor
+       *
+       * \param iter number of iterations
+       * \param rms root mean square
+       * \param params system parameters whose names are interned
+       */
       CalexResult(unsigned int const iter, double const rms, 
-        TsystemParameters const params) : Mcomputed(true), Miter(iter),
-        Mrms(rms), MsystemParameters(params)
-      { }
+        TsystemParameters const params);
+      /*!
+       * constructor
+       *
+       * \param iter number of iterations
+       * \param rms root mean square
+       * \param schema names of the system parameters
+       * \param values one value per name of \a schema
+       */
+      CalexResult(unsigned int const iter, double const rms,
+        ResultSchema const* schema, double const* values);
+      //! copy constructor
+      CalexResult(CalexResult const& rhs);
+      //! move constructor
+      CalexResult(CalexResult&& rhs);
+      //! destructor
+      ~CalexResult() { release(); }
+      //! copy assignment
+      CalexResult& operator=(CalexResult const& rhs);
+      //! move assignment
+      CalexResult& operator=(CalexResult&& rhs);
 
       //! query function if entire data had been set
-      bool isComputed() const { return Mcomputed; }
+      bool isComputed() const { return Computed == Mstatus; }
+      //! query function for result status
+      EresultStatus get_status() const { return Mstatus; }
+      //! query function for raw wait status of the calex process
+      int get_exitStatus() const { return MexitStatus; }
+      /*!
+       * member access function for the raw wait status of the calex process
+       *
+       * If the calex process did not exit normally with exit code zero the
+       * result will be marked as calex::Failed.
+       *
+       * \param status raw wait status as returned by \c waitpid
+       */
+      void set_exitStatus(int const status);
+      /*!
+       * mark the result as pruned, i.e. the calex run was terminated early
+       * (see calex::IterationMonitor)
+       *
+       * \param iter last iteration reported by calex
+       * \param rms RMS of the last iteration reported by calex
+       */
+      void set_pruned(unsigned int const iter, double const rms);
+      //! mark the result as timed out (see calex::RunLimits)
+      void set_timedOut() { Mstatus = TimedOut; }
+      //! mark the result as failed (e.g. calex output could not be parsed)
+      void set_failed() { Mstatus = Failed; }
       //! query function for number of iterations
       unsigned int const& get_iter() const { return Miter; }
       //! query function for root mean square
       double const& get_rms() const { return Mrms; }
-      //! query function for additional system parameters
-      std::vector<std::pair<std::string, double>> const& get_systemParameters()
-        const;
+      //! query function for the number of QUAD calls reported by calex
+      unsigned int get_quadCalls() const { return MquadCalls; }
+      //! query function for the convergence reported by calex
+      Econvergence get_convergence() const { return Mconvergence; }
+      /*!
+       * member access function for the convergence reported by calex
+       *
+       * \param quad_calls number of QUAD calls
+       * \param convergence convergence of the calex iteration
+       */
+      void set_convergence(unsigned int const quad_calls,
+          Econvergence const convergence)
+      {
+        MquadCalls = quad_calls;
+        Mconvergence = convergence;
+      }
+      //! query function for the names of the system parameters (may be 0)
+      ResultSchema const* get_schema() const { return Mschema; }
+      //! query function for the number of system parameters
+      size_t get_size() const { return Mschema ? Mschema->size() : 0; }
+      //! query function for the values of the system parameters
+      double const* get_values() const { return Mvalues; }
+      /*!
+       * query function for additional system parameters
+       *
+       * \note The pairs are assembled on each call. Use
+       * CalexResult::get_schema and CalexResult::get_values instead if
+       * performance matters.
+       */
+      TsystemParameters get_systemParameters() const;
       //! write the calex result data to an outputstream
       void writeLine(std::ostream& os) const;
       //! write header information to an outputstream
@@ -91,6 +272,8 @@ namespace calex
       //! output stream operator
       friend std::ostream& operator<<(
           std::ostream& os, CalexResult const& result);
+      //! restores the result status
+      friend class ResultFileReader;
 
     protected:
       //! read the calex result data from an inputstream
@@ -99,17 +282,187 @@ namespace calex
       void write(std::ostream& os) const;
 
     private:
-      //! flag if member data had been set
-      bool Mcomputed;
+      //! store the values of the system parameters of \a schema
+      void assign(ResultSchema const* schema, double const* values);
+      //! take over the values of the system parameters of \a rhs
+      void steal(CalexResult& rhs);
+      //! release values stored on the heap
+      void release();
+
+    private:
+      //! status of the result data
+      EresultStatus Mstatus;
+      //! raw wait status of the calex process
+      int MexitStatus;
       //! number of iterations
       unsigned int Miter;
       //! root mean square
       double Mrms;
-      //! additional result system parameters
-      TsystemParameters MsystemParameters;
+      //! number of QUAD calls
+      unsigned int MquadCalls;
+      //! convergence of the calex iteration
+      Econvergence Mconvergence;
+      //! names of the additional result system parameters
+      ResultSchema const* Mschema;
+      //! values of the system parameters (\c Minline or heap memory)
+      double* Mvalues;
+      //! values stored inline
+      double Minline[CALEX_RESULT_INLINE];
 
   }; // class CalexResult
 
+  /*=========================================================================*/
+  /*!
+   * Writer of calex result data in a compact binary format.
+   *
+   * Reading the text written by CalexResult::writeLine again is expensive
+   * for large numbers of results. A binary result file instead consists of
+   * (host byte order):
+   *  - header: magic \c CALEXRES, format version (\c uint32), number of
+   *    system parameters (\c uint32), size of a record (\c uint32), offset
+   *    of the first record (\c uint32)
+   *  - schema block: the names of the system parameters, each as length
+   *    (\c uint32) and characters, padded to a multiple of eight bytes
+   *  - records of fixed size: RMS (\c double), number of iterations and of
+   *    QUAD calls (\c uint32), result status and convergence (\c uint8),
+   *    two reserved bytes and four reserved bytes, followed by the values
+   *    of the system parameters (\c double)
+   *  - source block: the name of the source of each record (e.g. the calex
+   *    output file), each as length (\c uint32) and characters
+   *  - footer: offset of the source block (\c uint64) and magic \c
+   *    CALEXEND
+   *
+   * The schema of the file is the one of the first result written. Values
+   * of results of another schema are assigned by name; values missing are
+   * written as \c NaN. The source block and the footer are written by
+   * ResultFileWriter::close. Files without footer (e.g. of an interrupted
+   * run) still can be read except for the sources.
+   *
+   * The writer does not open the stream itself. Pass a buffered stream
+   * opened once for all results.
+   */
+  class ResultFileWriter
+  {
+    public:
+      /*!
+       * constructor
+       *
+       * \param os binary output stream
+       */
+      explicit ResultFileWriter(std::ostream& os);
+      //! destructor (closes the writer)
+      ~ResultFileWriter();
+      /*!
+       * write the result data of a calex run
+       *
+       * \param result result data
+       * \param source source of the result data (e.g. the calex output file)
+       */
+      void write(CalexResult const& result, std::string const& source);
+      //! write the source block and the footer
+      void close();
+      //! query function for the number of records written
+      size_t get_count() const { return Msources.size(); }
+
+    private:
+      //! copying is not allowed
+      ResultFileWriter(ResultFileWriter const&);
+      ResultFileWriter& operator=(ResultFileWriter const&);
+      //! write the header and the schema block
+      void writeHeader(ResultSchema const* schema);
+      //! write raw bytes
+      void put(void const* data, size_t const size);
+
+    private:
+      //! output stream
+      std::ostream& Mos;
+      //! schema of the file
+      ResultSchema const* Mschema;
+      //! header written
+      bool Mstarted;
+      //! source block and footer written
+      bool Mclosed;
+      //! number of bytes written
+      uint64_t Moffset;
+      //! sources of the records written
+      std::vector<std::string> Msources;
+      //! schema of the result written last if differing from the file's
+      ResultSchema const* Mforeign;
+      //! columns of the values of Mforeign within the file's schema
+      std::vector<int> Mcolumns;
+      //! record buffer
+      std::vector<char> Mrecord;
+
+  }; // class ResultFileWriter
+
+  /*=========================================================================*/
+  /*!
+   * Reader of binary result files written by calex::ResultFileWriter.
+   *
+   * Usage:
+   * \code
+   * calex::ResultFileReader reader("results.bin");
+   * calex::CalexResult result;
+   * for (size_t i = 0; i < reader.size(); ++i)
+   * {
+   *   reader.read(i, result);
+   *   std::cout << reader.get_source(i) << " " << result.get_rms() << "\n";
+   * }
+   * \endcode
+   */
+  class ResultFileReader
+  {
+    public:
+      /*!
+       * constructor
+       *
+       * \param path path of the binary result file
+       */
+      explicit ResultFileReader(std::string const& path);
+      //! query function for the number of records
+      size_t size() const { return Msize; }
+      //! query function for the names of the system parameters (may be 0)
+      ResultSchema const* get_schema() const { return Mschema; }
+      //! check if the sources of the records are available
+      bool hasSources() const { return ! Msources.empty() || ! Msize; }
+      /*!
+       * read the result data of a record
+       *
+       * \param i index of the record
+       * \param result result data to be filled
+       */
+      void read(size_t const i, CalexResult& result) const;
+      //! query function for the RMS of a record
+      double get_rms(size_t const i) const;
+      //! query function for the source of a record
+      std::string const& get_source(size_t const i) const;
+      /*!
+       * extract the values of a system parameter of all records
+       *
+       * \param j index of the name within ResultFileReader::get_schema
+       */
+      std::vector<double> column(size_t const j) const;
+
+    private:
+      //! begin of a record
+      char const* record(size_t const i) const;
+
+    private:
+      //! file contents
+      std::vector<char> Mdata;
+      //! names of the system parameters
+      ResultSchema const* Mschema;
+      //! offset of the first record
+      size_t Mfirst;
+      //! size of a record
+      size_t MrecordSize;
+      //! number of records
+      size_t Msize;
+      //! sources of the records
+      std::vector<std::string> Msources;
+
+  }; // class ResultFileReader
+
 } // namespace calex
 
 #endif // include guard
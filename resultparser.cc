@@ -0,0 +1,413 @@
+/*! \file resultparser.cc
+ * \brief Implementation of a fast parser for calex output files.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Implementation of a fast parser for calex output files.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  Parse the QUAD line following the final system
+ *                    parameters.
+ * 17/10/2026   V0.3  Results refer to an interned calex::ResultSchema.
+ * 17/10/2026   V0.4  Parse calex output files concurrently.
+ *
+ * ============================================================================
+ */
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <unistd.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <sys/stat.h>
+#include <atomic>
+#include <boost/thread.hpp>
+#include <calexxx/resultparser.h>
+#include <calexxx/error.h>
+
+namespace calex
+{
+  namespace
+  {
+    //! size of the tail of a file read first
+    const size_t CALEX_TAIL_WINDOW = 4096;
+    //! header line of the block of final system parameters
+    const char CALEX_FINAL_BLOCK[] = "final system parameters";
+    //! length of the header line
+    const size_t CALEX_FINAL_LENGTH = sizeof(CALEX_FINAL_BLOCK)-1;
+    //! beginning of the line reporting convergence
+    const char CALEX_QUAD_LINE[] = "QUAD called ";
+    //! length of the beginning of the line reporting convergence
+    const size_t CALEX_QUAD_LENGTH = sizeof(CALEX_QUAD_LINE)-1;
+    //! powers of ten represented exactly
+    const double CALEX_POW10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+      1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19,
+      1e20, 1e21, 1e22};
+    //! number of files claimed at once by a thread parsing concurrently
+    const size_t CALEX_PARSE_CHUNK = 64;
+    //! parser of each thread
+    boost::thread_specific_ptr<ResultParser> thread_parser;
+
+    /*-----------------------------------------------------------------------*/
+    //! whitespace as skipped by \c std::ws
+    inline bool isSpace(char const c)
+    {
+      return ' ' == c || '\t' == c || '\n' == c || '\r' == c || '\f' == c ||
+        '\v' == c;
+    }
+
+    /*-----------------------------------------------------------------------*/
+    //! characters of a number passed to \c strtod
+    inline bool isNumeric(char const c)
+    {
+      return (c >= '0' && c <= '9') || '.' == c || '+' == c || '-' == c ||
+        'e' == c || 'E' == c;
+    }
+
+    /*-----------------------------------------------------------------------*/
+    /*!
+     * search the header line of the last block of final system parameters
+     *
+     * \param data begin of the data
+     * \param end end of the data
+     * \param complete \a data is the beginning of the output
+     * \param truncated set if the header line might start before \a data
+     *
+     * \return header line or 0 if not found
+     */
+    char const* locate(char const* data, char const* end, bool const complete,
+        bool& truncated)
+    {
+      truncated = false;
+      if (static_cast<size_t>(end-data) < CALEX_FINAL_LENGTH)
+      {
+        truncated = ! complete;
+        return 0;
+      }
+      for (char const* p = end-CALEX_FINAL_LENGTH; p >= data; --p)
+      {
+        if (CALEX_FINAL_BLOCK[0] != *p ||
+            0 != memcmp(p, CALEX_FINAL_BLOCK, CALEX_FINAL_LENGTH))
+        {
+          continue;
+        }
+        // the header must be terminated by a colon or the end of the line
+        char const* q = p+CALEX_FINAL_LENGTH;
+        if (q != end && ':' != *q && '\n' != *q) { continue; }
+        // only whitespace must precede the header within its line
+        char const* s = p;
+        while (s > data && '\n' != s[-1] && isSpace(s[-1])) { --s; }
+        if (s > data && '\n' != s[-1]) { continue; }
+        if (s == data && ! complete)
+        {
+          truncated = true;
+          return 0;
+        }
+        return p;
+      }
+      truncated = ! complete;
+      return 0;
+    }
+
+    /*-----------------------------------------------------------------------*/
+    //! begin of the next line not consisting of whitespace only
+    char const* nextLine(char const* p, char const* end)
+    {
+      while (p != end && '\n' != *p) { ++p; }
+      while (p != end && isSpace(*p)) { ++p; }
+      return p;
+    }
+
+  } // namespace (unnamed)
+
+  /*=========================================================================*/
+  ResultParser::ResultParser() : Mfound(false), MquadCalls(0),
+    Mconvergence(UnknownConvergence), Mschema(0)
+  { }
+
+  /*-------------------------------------------------------------------------*/
+  ResultParser& ResultParser::local()
+  {
+    if (! thread_parser.get()) { thread_parser.reset(new ResultParser); }
+    return *thread_parser;
+  } // function ResultParser::local
+
+  /*-------------------------------------------------------------------------*/
+  bool ResultParser::parseFile(std::string const& path)
+  {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (-1 == fd) { return false; }
+    struct stat st;
+    if (0 != fstat(fd, &st))
+    {
+      close(fd);
+      return false;
+    }
+    size_t const size = st.st_size;
+    size_t window = size < CALEX_TAIL_WINDOW ? size : CALEX_TAIL_WINDOW;
+    for (;;)
+    {
+      if (Mbuffer.size() < window+1) { Mbuffer.resize(window+1); }
+      char* data = &Mbuffer[0];
+      size_t done = 0;
+      while (done < window)
+      {
+        ssize_t n = pread(fd, data+done, window-done, size-window+done);
+        if (-1 == n && EINTR == errno) { continue; }
+        if (n <= 0) { break; }
+        done += n;
+      }
+      if (done != window)
+      {
+        close(fd);
+        return false;
+      }
+      bool truncated;
+      char const* header = locate(data, data+window, window == size,
+          truncated);
+      if (! truncated)
+      {
+        close(fd);
+        extract(header, data+window);
+        return true;
+      }
+      // the block starts before the window
+      window = size/4 < window ? size : 4*window;
+    }
+  } // function ResultParser::parseFile
+
+  /*-------------------------------------------------------------------------*/
+  void ResultParser::parse(char const* data, size_t const size)
+  {
+    bool truncated;
+    extract(locate(data, data+size, true, truncated), data+size);
+  } // function ResultParser::parse
+
+  /*-------------------------------------------------------------------------*/
+  void ResultParser::extract(char const* header, char const* end)
+  {
+    Mnames.clear();
+    Mvalues.clear();
+    MquadCalls = 0;
+    Mconvergence = UnknownConvergence;
+    Mfound = 0 != header;
+    if (! Mfound) { return; }
+
+    // collect names of result data
+    char const* p = nextLine(header, end);
+    while (p != end && '\n' != *p)
+    {
+      char const* token = p;
+      while (p != end && ! isSpace(*p)) { ++p; }
+      Mnames.push_back(Tname(token, p-token));
+      while (p != end && '\n' != *p && isSpace(*p)) { ++p; }
+    }
+
+    // collect result data
+    p = nextLine(p, end);
+    while (p != end && '\n' != *p)
+    {
+      double value;
+      char const* q = parseNumber(p, end, value);
+      if (q == p) { break; }
+      Mvalues.push_back(value);
+      p = q;
+      while (p != end && '\n' != *p && isSpace(*p)) { ++p; }
+    }
+
+    CALEX_assert(Mvalues.size() == Mnames.size() && Mvalues.size() >= 2,
+        "Error while reading result data.");
+
+    // QUAD line reporting convergence
+    for (p = nextLine(p, end); p != end; p = nextLine(p, end))
+    {
+      if (static_cast<size_t>(end-p) < CALEX_QUAD_LENGTH ||
+          0 != memcmp(p, CALEX_QUAD_LINE, CALEX_QUAD_LENGTH))
+      {
+        continue;
+      }
+      p += CALEX_QUAD_LENGTH;
+      while (p != end && ' ' == *p) { ++p; }
+      double calls;
+      char const* q = parseNumber(p, end, calls);
+      if (q != p) { MquadCalls = static_cast<unsigned int>(calls); }
+      char const* eol = q;
+      while (eol != end && '\n' != *eol) { ++eol; }
+      static const char converged[] = "converged";
+      static const char negated[] = "not converged";
+      for (; q+sizeof(converged)-1 <= eol; ++q)
+      {
+        if (q+sizeof(negated)-1 <= eol &&
+            0 == memcmp(q, negated, sizeof(negated)-1))
+        {
+          Mconvergence = NotConverged;
+          break;
+        }
+        if (0 == memcmp(q, converged, sizeof(converged)-1))
+        {
+          Mconvergence = Converged;
+          break;
+        }
+      }
+      break;
+    }
+  } // function ResultParser::extract
+
+  /*-------------------------------------------------------------------------*/
+  void ResultParser::get_result(CalexResult& result) const
+  {
+    // names of the system parameters follow iter and RMS
+    ResultSchema const* schema = 0;
+    if (Mvalues.size() > 2)
+    {
+      if (! Mschema || ! Mschema->matches(&Mnames[2], Mnames.size()-2))
+      {
+        Mschema = ResultSchema::intern(&Mnames[2], Mnames.size()-2);
+      }
+      schema = Mschema;
+    }
+    result = CalexResult(get_iter(), get_rms(), schema,
+        schema ? &Mvalues[2] : 0);
+    result.set_convergence(MquadCalls, Mconvergence);
+  } // function ResultParser::get_result
+
+  /*=========================================================================*/
+  char const* parseNumber(char const* begin, char const* end, double& value)
+  {
+    char const* p = begin;
+    bool const negative = p != end && '-' == *p;
+    if (p != end && ('-' == *p || '+' == *p)) { ++p; }
+    uint64_t mantissa = 0;
+    unsigned int digits = 0;
+    unsigned int decimals = 0;
+    bool any = false;
+    for (; p != end && *p >= '0' && *p <= '9'; ++p)
+    {
+      any = true;
+      if (mantissa || '0' != *p) { ++digits; }
+      if (digits <= 19) { mantissa = 10*mantissa+(*p-'0'); }
+    }
+    if (p != end && '.' == *p)
+    {
+      for (++p; p != end && *p >= '0' && *p <= '9'; ++p)
+      {
+        any = true;
+        if (mantissa || '0' != *p) { ++digits; }
+        if (digits <= 19) { mantissa = 10*mantissa+(*p-'0'); }
+        ++decimals;
+      }
+    }
+    if (! any) { return begin; }
+    // mantissa and power of ten are exact - the quotient is rounded correctly
+    if ((p == end || ('e' != *p && 'E' != *p)) &&
+        mantissa < (static_cast<uint64_t>(1) << 53) && digits <= 19 &&
+        decimals < sizeof(CALEX_POW10)/sizeof(CALEX_POW10[0]))
+    {
+      value = static_cast<double>(mantissa)/CALEX_POW10[decimals];
+      if (negative) { value = -value; }
+      return p;
+    }
+
+    // exponents and long mantissas are converted by strtod
+    char number[64];
+    size_t n = 0;
+    for (p = begin; p != end && n < sizeof(number)-1 && isNumeric(*p); ++p)
+    {
+      number[n++] = *p;
+    }
+    number[n] = '\0';
+    char* stop;
+    value = strtod(number, &stop);
+    return begin+(stop-number);
+  } // function parseNumber
+
+  /*=========================================================================*/
+  namespace
+  {
+    //! parse chunks of files until none is left
+    void parseChunks(std::vector<std::string> const* paths,
+        std::vector<CalexResult>* results, std::atomic<size_t>* next)
+    {
+      ResultParser& parser(ResultParser::local());
+      size_t const size = paths->size();
+      for (;;)
+      {
+        size_t const begin = next->fetch_add(CALEX_PARSE_CHUNK);
+        if (begin >= size) { return; }
+        size_t const end = begin+CALEX_PARSE_CHUNK < size ?
+          begin+CALEX_PARSE_CHUNK : size;
+        for (size_t i = begin; i < end; ++i)
+        {
+          // exceptions must not escape the thread
+          try
+          {
+            if (parser.parseFile((*paths)[i]))
+            {
+              parser.get_result((*results)[i]);
+            } else
+            {
+              (*results)[i] = CalexResult();
+            }
+          }
+          catch (...)
+          {
+            (*results)[i] = CalexResult();
+            (*results)[i].set_failed();
+          }
+        }
+      }
+    } // function parseChunks
+
+  } // namespace (unnamed)
+
+  /*-------------------------------------------------------------------------*/
+  void parseFiles(std::vector<std::string> const& paths,
+      std::vector<CalexResult>& results, unsigned int threads)
+  {
+    results.resize(paths.size());
+    if (0 == threads) { threads = boost::thread::hardware_concurrency(); }
+    size_t const chunks = (paths.size()+CALEX_PARSE_CHUNK-1)/CALEX_PARSE_CHUNK;
+    if (threads > chunks) { threads = chunks; }
+    std::atomic<size_t> next(0);
+    if (threads <= 1)
+    {
+      parseChunks(&paths, &results, &next);
+      return;
+    }
+    boost::thread_group group;
+    for (unsigned int t = 0; t < threads; ++t)
+    {
+      group.create_thread(boost::bind(&parseChunks, &paths, &results, &next));
+    }
+    group.join_all();
+  } // function parseFiles
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+/* ----- END OF resultparser.cc  ----- */
@@ -0,0 +1,210 @@
+/*! \file resultparser.h
+ * \brief Declaration of a fast parser for calex output files.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Declaration of a fast parser for calex output files.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  Parse the QUAD line following the final system
+ *                    parameters.
+ * 17/10/2026   V0.3  Results refer to an interned calex::ResultSchema.
+ * 17/10/2026   V0.4  Parse calex output files concurrently.
+ *
+ * ============================================================================
+ */
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <calexxx/resultdata.h>
+#include <calexxx/error.h>
+
+#ifndef _CALEX_RESULTPARSER_H_
+#define _CALEX_RESULTPARSER_H_
+
+namespace calex
+{
+  /*=========================================================================*/
+  /*!
+   * Fast parser for calex \c *.out files.
+   *
+   * The input stream operator of calex::CalexResult reads the output line by
+   * line from the top and creates string streams for the block of final
+   * system parameters. The parser instead searches the final block backward
+   * from the end of the output:
+   *  - Files are read from their tail by \c pread. The window read is
+   *    enlarged only if the block does not start within it.
+   *  - Names of the result data refer to the parser's buffer and values are
+   *    stored in a vector reused by the next call.
+   *  - Numbers are converted in place without creating a string first.
+   *
+   * Once the buffers have grown to the size of the largest file parsed no
+   * heap memory is allocated anymore. The names of the system parameters
+   * are interned by calex::ResultSchema; the schema of the last conversion
+   * is cached such that converting the data into a calex::CalexResult does
+   * not allocate either as long as the values fit inline. A parser is not
+   * thread safe. Use
+   * ResultParser::local to obtain a parser of the current thread.
+   *
+   * The results are identical to the ones of the input stream operator of
+   * calex::CalexResult. If a file contains several blocks of final system
+   * parameters, the last one is used.
+   *
+   * Usage:
+   * \code
+   * calex::ResultParser& parser(calex::ResultParser::local());
+   * calex::CalexResult result;
+   * if (parser.parseFile("calex.out")) { parser.get_result(result); }
+   * \endcode
+   */
+  class ResultParser
+  {
+    public:
+      //! name of a result value referring to the buffer parsed
+      typedef std::pair<char const*, size_t> Tname;
+
+    public:
+      //! constructor
+      ResultParser();
+      //! parser of the current thread
+      static ResultParser& local();
+      /*!
+       * parse a calex output file
+       *
+       * \param path path of the \c *.out file
+       *
+       * \return false if the file cannot be read
+       */
+      bool parseFile(std::string const& path);
+      /*!
+       * parse calex output in memory
+       *
+       * Names refer to \a data which therefore must be valid as long as the
+       * names are queried.
+       *
+       * \param data calex output
+       * \param size number of bytes
+       */
+      void parse(char const* data, size_t const size);
+      //! query function if a block of final system parameters was found
+      bool found() const { return Mfound; }
+      //! query function for the number of values including iter and RMS
+      size_t get_size() const { return Mvalues.size(); }
+      //! query function for the names of the values
+      std::vector<Tname> const& get_names() const { return Mnames; }
+      //! query function for the values
+      std::vector<double> const& get_values() const { return Mvalues; }
+      //! query function for number of iterations
+      unsigned int get_iter() const
+      { return Mvalues.empty() ? 0 : static_cast<unsigned int>(Mvalues[0]); }
+      //! query function for root mean square
+      double get_rms() const { return Mvalues.size() < 2 ? 0. : Mvalues[1]; }
+      //! query function for the number of QUAD calls
+      unsigned int get_quadCalls() const { return MquadCalls; }
+      //! query function for the convergence reported by calex
+      Econvergence get_convergence() const { return Mconvergence; }
+      /*!
+       * convert the data parsed last into result data
+       *
+       * \param result result data to be filled
+       */
+      void get_result(CalexResult& result) const;
+
+    private:
+      //! copying is not allowed
+      ResultParser(ResultParser const&);
+      ResultParser& operator=(ResultParser const&);
+      /*!
+       * collect names and values of the block of final system parameters
+       *
+       * \param header header line of the block or 0 if not found
+       * \param end end of the data
+       */
+      void extract(char const* header, char const* end);
+
+    private:
+      //! buffer the tail of the file is read into
+      std::vector<char> Mbuffer;
+      //! names of the values
+      std::vector<Tname> Mnames;
+      //! values
+      std::vector<double> Mvalues;
+      //! block of final system parameters found
+      bool Mfound;
+      //! number of QUAD calls
+      unsigned int MquadCalls;
+      //! convergence reported by calex
+      Econvergence Mconvergence;
+      //! schema of the names converted last
+      mutable ResultSchema const* Mschema;
+
+  }; // class ResultParser
+
+  /*=========================================================================*/
+  /*!
+   * convert the number at the beginning of a character range
+   *
+   * Conversions are identical to the ones of the input stream operator for
+   * \c double. Plain decimal numbers as written by calex are converted
+   * without calling \c strtod. Their digits form an integer represented
+   * exactly by a \c double which is divided by an exact power of ten, such
+   * that the result is rounded correctly.
+   *
+   * \param begin begin of the range
+   * \param end end of the range
+   * \param value value converted
+   *
+   * \return pointer past the characters converted, \a begin if no number
+   * was found
+   */
+  char const* parseNumber(char const* begin, char const* end, double& value);
+
+  /*=========================================================================*/
+  /*!
+   * parse calex output files concurrently
+   *
+   * The files are claimed in chunks by \a threads threads, each parsing by
+   * its calex::ResultParser::local. The results are stored in the order of
+   * \a paths independent of the number of threads. For very large numbers
+   * of files call this function repeatedly with blocks of the paths such
+   * that the results of a block can be written before the next one is
+   * parsed.
+   *
+   * \param paths paths of the \c *.out files
+   * \param results result data (calex::NotComputed if a file cannot be
+   * read, calex::Failed if its contents cannot be parsed)
+   * \param threads number of threads (0: number of hardware threads)
+   */
+  void parseFiles(std::vector<std::string> const& paths,
+      std::vector<CalexResult>& results, unsigned int threads=0);
+
+} // namespace calex
+
+#endif // include guard
+
+/* ----- END OF resultparser.h  ----- */
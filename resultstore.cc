@@ -0,0 +1,225 @@
+/*! \file resultstore.cc
+ * \brief Implementation of a columnar store of the result data of a grid.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Implementation of a columnar store of the result data of a grid.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  Coordinate indexes are computed by calex::GridAxes.
+ *
+ * ============================================================================
+ */
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <calexxx/resultstore.h>
+#include <calexxx/error.h>
+
+namespace calex
+{
+  namespace
+  {
+    //! number of independent minima kept while scanning a column
+    const size_t CALEX_SCAN_LANES = 8;
+
+    /*-----------------------------------------------------------------------*/
+    //! smallest value of a range
+    double minimum(double const* values, size_t const size)
+    {
+      // independent lanes permit the compiler to vectorize the scan
+      double lanes[CALEX_SCAN_LANES];
+      std::fill(lanes, lanes+CALEX_SCAN_LANES, HUGE_VAL);
+      size_t i = 0;
+      for (; i+CALEX_SCAN_LANES <= size; i += CALEX_SCAN_LANES)
+      {
+        for (size_t j = 0; j < CALEX_SCAN_LANES; ++j)
+        {
+          lanes[j] = values[i+j] < lanes[j] ? values[i+j] : lanes[j];
+        }
+      }
+      for (; i < size; ++i)
+      {
+        lanes[0] = values[i] < lanes[0] ? values[i] : lanes[0];
+      }
+      return *std::min_element(lanes, lanes+CALEX_SCAN_LANES);
+    } // function minimum
+
+  } // namespace (unnamed)
+
+  /*=========================================================================*/
+  ResultStore::ResultStore(CalexConfig const& config) : Maxes(config),
+    Mschema(0)
+  {
+    allocate();
+  }
+
+  /*-------------------------------------------------------------------------*/
+  ResultStore::ResultStore(Taxes const& axes) : Maxes(axes), Mschema(0)
+  {
+    allocate();
+  }
+
+  /*-------------------------------------------------------------------------*/
+  void ResultStore::allocate()
+  {
+    Mrms.assign(Maxes.size(), HUGE_VAL);
+    Miter.assign(Maxes.size(), 0);
+    Mstatus.assign(Maxes.size(), NotComputed);
+  } // function ResultStore::allocate
+
+  /*-------------------------------------------------------------------------*/
+  void ResultStore::store(size_t const index, CalexResult const& result)
+  {
+    CALEX_assert(index < size(), "Coordinate index out of range.");
+    Mrms[index] = result.isComputed() ? result.get_rms() : HUGE_VAL;
+    Miter[index] = result.get_iter();
+    Mstatus[index] = static_cast<unsigned char>(result.get_status());
+    if (! result.get_schema()) { return; }
+    ResultSchema const* schema = Mschema;
+    if (! schema) { schema = adopt(result.get_schema()); }
+    if (schema != result.get_schema()) { return; }
+    double const* values = result.get_values();
+    for (size_t i = 0; i < schema->size(); ++i)
+    {
+      Mparameters[i*size()+index] = values[i];
+    }
+  } // function ResultStore::store
+
+  /*-------------------------------------------------------------------------*/
+  ResultSchema const* ResultStore::adopt(ResultSchema const* schema)
+  {
+    boost::mutex::scoped_lock lock(Mmutex);
+    if (! Mschema)
+    {
+      Mparameters.assign(schema->size()*size(),
+          std::numeric_limits<double>::quiet_NaN());
+      Mschema = schema;
+    }
+    return Mschema;
+  } // function ResultStore::adopt
+
+  /*-------------------------------------------------------------------------*/
+  double const* ResultStore::get_column(size_t const i) const
+  {
+    ResultSchema const* schema = Mschema;
+    CALEX_assert(schema && i < schema->size(),
+        "Column of final system parameter not available.");
+    return &Mparameters[i*size()];
+  } // function ResultStore::get_column
+
+  /*-------------------------------------------------------------------------*/
+  size_t ResultStore::argmin() const
+  {
+    double const* rms = get_rms();
+    double const min = minimum(rms, size());
+    if (HUGE_VAL == min) { return npos; }
+    return std::find(rms, rms+size(), min)-rms;
+  } // function ResultStore::argmin
+
+  /*-------------------------------------------------------------------------*/
+  std::vector<size_t> ResultStore::topk(size_t const k) const
+  {
+    // max-heap of the best results found so far
+    std::vector<std::pair<double, size_t>> heap;
+    heap.reserve(k);
+    double const* rms = get_rms();
+    double worst = HUGE_VAL;
+    for (size_t i = 0; i < size() && k > 0; ++i)
+    {
+      if (! (rms[i] < worst)) { continue; }
+      if (heap.size() == k)
+      {
+        std::pop_heap(heap.begin(), heap.end());
+        heap.back() = std::make_pair(rms[i], i);
+      } else
+      {
+        heap.push_back(std::make_pair(rms[i], i));
+      }
+      std::push_heap(heap.begin(), heap.end());
+      if (heap.size() == k) { worst = heap.front().first; }
+    }
+    std::sort_heap(heap.begin(), heap.end());
+    std::vector<size_t> indexes;
+    indexes.reserve(heap.size());
+    for (auto cit(heap.cbegin()); cit != heap.cend(); ++cit)
+    {
+      indexes.push_back(cit->second);
+    }
+    return indexes;
+  } // function ResultStore::topk
+
+  /*-------------------------------------------------------------------------*/
+  std::vector<size_t> ResultStore::filter(double const max_rms) const
+  {
+    std::vector<size_t> indexes;
+    double const* rms = get_rms();
+    for (size_t i = 0; i < size(); ++i)
+    {
+      if (rms[i] <= max_rms && HUGE_VAL != rms[i]) { indexes.push_back(i); }
+    }
+    return indexes;
+  } // function ResultStore::filter
+
+  /*-------------------------------------------------------------------------*/
+  std::vector<double> ResultStore::marginalMinima(
+      unsigned int const dimension) const
+  {
+    CALEX_assert(dimension < get_dimensions(), "Invalid dimension.");
+    size_t const samples = Maxes[dimension].Msamples;
+    // nodes sharing a coordinate form contiguous runs of stride nodes
+    size_t const stride = Maxes.get_stride(dimension);
+    size_t const blocks = size()/(stride*samples);
+    std::vector<double> minima(samples, HUGE_VAL);
+    double const* rms = get_rms();
+    for (size_t block = 0; block < blocks; ++block)
+    {
+      // the last dimension varies fastest
+      if (1 == stride)
+      {
+        double const* row = rms+block*samples;
+        for (size_t j = 0; j < samples; ++j)
+        {
+          minima[j] = row[j] < minima[j] ? row[j] : minima[j];
+        }
+        continue;
+      }
+      for (size_t j = 0; j < samples; ++j)
+      {
+        double const min = minimum(rms+(block*samples+j)*stride, stride);
+        if (min < minima[j]) { minima[j] = min; }
+      }
+    }
+    return minima;
+  } // function ResultStore::marginalMinima
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+/* ----- END OF resultstore.cc  ----- */
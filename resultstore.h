@@ -0,0 +1,242 @@
+/*! \file resultstore.h
+ * \brief Declaration of a columnar store of the result data of a grid.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Declaration of a columnar store of the result data of a grid.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  Coordinate indexes are computed by calex::GridAxes.
+ *
+ * ============================================================================
+ */
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <cmath>
+#include <boost/thread.hpp>
+#include <calexxx/calexconfig.h>
+#include <calexxx/gridaxes.h>
+#include <calexxx/resultdata.h>
+#include <calexxx/error.h>
+
+#ifndef _CALEX_RESULTSTORE_H_
+#define _CALEX_RESULTSTORE_H_
+
+namespace calex
+{
+  /*=========================================================================*/
+  /*!
+   * Columnar store of the result data of a whole parameter space grid.
+   *
+   * Finding the best fits after a sweep otherwise requires traversing all
+   * nodes of the grid and querying the result data of each. The store
+   * instead keeps the result data in contiguous arrays (columns) indexed by
+   * the node's coordinate index:
+   *  - RMS (\c HUGE_VAL if the result was not computed)
+   *  - number of iterations
+   *  - result status (calex::EresultStatus)
+   *  - one column per final system parameter (\c NaN if missing)
+   *
+   * The coordinate index of a node is computed from the axes of the
+   * parameter space (see calex::GridAxes). The axes are taken from a
+   * synchronized calex::CalexConfig or passed explicitly. The columns of the
+   * final system parameters are created by the first result providing a
+   * calex::ResultSchema; results of a different schema only fill the
+   * remaining columns.
+   *
+   * Storing results of distinct nodes is thread safe. Queries must not run
+   * concurrently with storing. All queries are single passes over the
+   * contiguous columns.
+   *
+   * Usage:
+   * \code
+   * std::shared_ptr<calex::ResultStore> store(
+   *     new calex::ResultStore(config));
+   * app.set_resultStore(store);
+   * grid->accept(app);
+   * size_t best = store->argmin();
+   * std::vector<double> coordinates(store->coordinates(best));
+   * \endcode
+   */
+  class ResultStore
+  {
+    public:
+      //! regular axis of the parameter space
+      typedef GridAxes::Axis Axis;
+      //! axes of the parameter space ordered by coordinate id
+      typedef GridAxes::Taxes Taxes;
+      //! index of no node
+      static const size_t npos = GridAxes::npos;
+
+    public:
+      /*!
+       * constructor
+       *
+       * \param config Synchronized configuration providing the axes of its
+       * grid system parameters.
+       */
+      explicit ResultStore(CalexConfig const& config);
+      /*!
+       * constructor
+       *
+       * \param axes axes of the parameter space
+       */
+      explicit ResultStore(Taxes const& axes);
+      //! query function for the number of nodes
+      size_t size() const { return Mrms.size(); }
+      //! query function for the number of dimensions
+      unsigned int get_dimensions() const { return Maxes.get_dimensions(); }
+      //! query function for the axes
+      GridAxes const& get_axes() const { return Maxes; }
+      /*!
+       * compute the coordinate index of a node
+       *
+       * \param coordinates coordinates of the node
+       *
+       * \return coordinate index or ResultStore::npos if the coordinates
+       * are not within the parameter space (e.g. nodes of subgrids of
+       * another dimension)
+       */
+      template <typename Ctype>
+      size_t index(std::vector<Ctype> const& coordinates) const
+      { return Maxes.index(coordinates); }
+      //! compute the coordinates of the node with coordinate index \a index
+      std::vector<double> coordinates(size_t const index) const
+      { return Maxes.coordinates(index); }
+      /*!
+       * store the result data of a node
+       *
+       * \param index coordinate index of the node
+       * \param result result data of the node
+       */
+      void store(size_t const index, CalexResult const& result);
+      /*!
+       * store the result data of a node
+       *
+       * \param coordinates coordinates of the node
+       * \param result result data of the node
+       *
+       * \return false if the coordinates are not within the parameter space
+       */
+      template <typename Ctype>
+      bool store(std::vector<Ctype> const& coordinates,
+          CalexResult const& result);
+      //! query function for the RMS column
+      double const* get_rms() const { return &Mrms[0]; }
+      //! query function for the column of the number of iterations
+      unsigned int const* get_iter() const { return &Miter[0]; }
+      //! query function for the column of the result status
+      unsigned char const* get_status() const { return &Mstatus[0]; }
+      //! query function for the names of the final parameters (may be 0)
+      ResultSchema const* get_schema() const { return Mschema; }
+      /*!
+       * query function for the column of a final system parameter
+       *
+       * \param i index of the name within ResultStore::get_schema
+       */
+      double const* get_column(size_t const i) const;
+      /*!
+       * find the node with the smallest RMS
+       *
+       * \return coordinate index or ResultStore::npos if no result was
+       * computed
+       */
+      size_t argmin() const;
+      /*!
+       * find the nodes with the smallest RMS
+       *
+       * \param k number of nodes
+       *
+       * \return coordinate indexes of at most \a k computed results ordered
+       * by increasing RMS
+       */
+      std::vector<size_t> topk(size_t const k) const;
+      /*!
+       * find all nodes with an RMS not exceeding a threshold
+       *
+       * \param max_rms threshold
+       *
+       * \return coordinate indexes in increasing order
+       */
+      std::vector<size_t> filter(double const max_rms) const;
+      /*!
+       * compute the smallest RMS for every coordinate of a dimension
+       *
+       * \param dimension coordinate id of the dimension
+       *
+       * \return minimum RMS over all nodes sharing the coordinate (\c
+       * HUGE_VAL if none of them was computed)
+       */
+      std::vector<double> marginalMinima(unsigned int const dimension) const;
+
+    private:
+      //! copying is not allowed
+      ResultStore(ResultStore const&);
+      ResultStore& operator=(ResultStore const&);
+      //! allocate the columns
+      void allocate();
+      //! create the columns of the final system parameters of \a schema
+      ResultSchema const* adopt(ResultSchema const* schema);
+
+    private:
+      //! axes of the parameter space
+      GridAxes Maxes;
+      //! RMS column
+      std::vector<double> Mrms;
+      //! column of the number of iterations
+      std::vector<unsigned int> Miter;
+      //! column of the result status
+      std::vector<unsigned char> Mstatus;
+      //! columns of the final system parameters one after another
+      std::vector<double> Mparameters;
+      //! names of the final system parameters
+      std::atomic<ResultSchema const*> Mschema;
+      //! mutual exclusion variable protecting creating the columns
+      boost::mutex Mmutex;
+
+  }; // class ResultStore
+
+  /*=========================================================================*/
+  template <typename Ctype>
+  bool ResultStore::store(std::vector<Ctype> const& coordinates,
+      CalexResult const& result)
+  {
+    size_t const idx = index(coordinates);
+    if (npos == idx) { return false; }
+    store(idx, result);
+    return true;
+  } // function template ResultStore::store
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+#endif // include guard
+
+/* ----- END OF resultstore.h  ----- */
@@ -0,0 +1,191 @@
+/*! \file scratchdir.cc
+ * \brief Implementation of isolated scratch directories for calex runs.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Implementation of isolated scratch directories for calex runs.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  calex::ParameterFile.
+ *
+ * ============================================================================
+ */
+
+#include <sstream>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <atomic>
+#include <boost/thread.hpp>
+#include <calexxx/scratchdir.h>
+#include <calexxx/error.h>
+
+namespace calex
+{
+  namespace
+  {
+    //! per-thread naming state
+    struct ThreadSlot
+    {
+      //! slot number of the thread
+      long Mslot;
+      //! sequence number of the next scratch directory
+      unsigned long Mseq;
+    }; // struct ThreadSlot
+
+    //! number of threads which already created a scratch directory
+    std::atomic<long> slot_count(0);
+    //! naming state of the current thread
+    boost::thread_specific_ptr<ThreadSlot> thread_slot;
+
+    /*-----------------------------------------------------------------------*/
+    //! fetch the naming state of the current thread
+    ThreadSlot& currentSlot()
+    {
+      if (! thread_slot.get())
+      {
+        ThreadSlot* slot = new ThreadSlot;
+        slot->Mslot = ++slot_count;
+        slot->Mseq = 0;
+        thread_slot.reset(slot);
+      }
+      return *thread_slot;
+    }
+
+  } // namespace (unnamed)
+
+  /*=========================================================================*/
+  ScratchDirectory::ScratchDirectory(std::string const& root,
+      std::string const& prefix) : Mexists(false)
+  {
+    ThreadSlot& slot = currentSlot();
+    std::ostringstream oss;
+    oss << root << "/" << prefix << "-" << getpid() << "-t" << slot.Mslot
+      << "-" << slot.Mseq++;
+    Mpath = oss.str();
+    if (0 != mkdir(Mpath.c_str(), 0700))
+    {
+      // a stale directory of a previous process with the same pid
+      CALEX_assert(EEXIST == errno,
+          "Error while creating scratch directory.");
+      Mexists = true;
+      remove();
+      CALEX_assert(0 == mkdir(Mpath.c_str(), 0700),
+          "Error while creating scratch directory.");
+    }
+    Mexists = true;
+  }
+
+  /*-------------------------------------------------------------------------*/
+  ScratchDirectory::~ScratchDirectory()
+  {
+    // destructors must not throw
+    try { remove(); } catch (...) { }
+  }
+
+  /*-------------------------------------------------------------------------*/
+  void ScratchDirectory::link(std::string const& target,
+      std::string const& name) const
+  {
+    std::string linkpath(Mpath+"/"+name);
+    CALEX_assert(0 == symlink(absolutePath(target).c_str(), linkpath.c_str()),
+        "Error while creating symbolic link in scratch directory.");
+  }
+
+  /*-------------------------------------------------------------------------*/
+  void ScratchDirectory::remove()
+  {
+    if (! Mexists) { return; }
+    int fd = open(Mpath.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    CALEX_assert(-1 != fd, "Error while opening scratch directory.");
+    DIR* dir = fdopendir(fd);
+    CALEX_assert(0 != dir, "Error while opening scratch directory.");
+    struct dirent* entry;
+    while (0 != (entry = readdir(dir)))
+    {
+      if (0 == strcmp(entry->d_name, ".") || 0 == strcmp(entry->d_name, ".."))
+      {
+        continue;
+      }
+      // symbolic links are removed themselves - never their targets
+      unlinkat(fd, entry->d_name, 0);
+    }
+    closedir(dir);
+    CALEX_assert(0 == rmdir(Mpath.c_str()),
+        "Error while removing scratch directory.");
+    Mexists = false;
+  }
+
+  /*=========================================================================*/
+  ParameterFile::ParameterFile() : Mexists(true)
+  {
+    std::ostringstream oss;
+    oss << "calex-" << boost::this_thread::get_id() << "-"
+      << currentSlot().Mseq++ << ".par";
+    Mpath = oss.str();
+  }
+
+  /*-------------------------------------------------------------------------*/
+  ParameterFile::ParameterFile(std::string const& path) : Mpath(path),
+    Mexists(true)
+  { }
+
+  /*-------------------------------------------------------------------------*/
+  ParameterFile::~ParameterFile()
+  {
+    // the file may not have been written
+    if (Mexists) { unlink(Mpath.c_str()); }
+  }
+
+  /*-------------------------------------------------------------------------*/
+  void ParameterFile::remove()
+  {
+    if (! Mexists) { return; }
+    Mexists = false;
+    CALEX_assert(0 == unlink(Mpath.c_str()),
+        "Error while removing current calex files");
+  }
+
+  /*=========================================================================*/
+  std::string absolutePath(std::string const& path)
+  {
+    if (! path.empty() && '/' == path[0]) { return path; }
+    char cwd[PATH_MAX];
+    CALEX_assert(0 != getcwd(cwd, sizeof(cwd)),
+        "Error while querying current working directory.");
+    return std::string(cwd)+"/"+path;
+  }
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+/* ----- END OF scratchdir.cc  ----- */
@@ -0,0 +1,167 @@
+/*! \file scratchdir.h
+ * \brief Declaration of isolated scratch directories for calex runs.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Declaration of isolated scratch directories for calex runs.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  calex::ParameterFile removes parameter files of runs
+ *                    outside scratch directories.
+ *
+ * ============================================================================
+ */
+
+#include <string>
+#include <calexxx/error.h>
+
+#ifndef _CALEX_SCRATCHDIR_H_
+#define _CALEX_SCRATCHDIR_H_
+
+namespace calex
+{
+  /*=========================================================================*/
+  /*!
+   * Isolated scratch directory for a single calex run.
+   *
+   * calex writes the files \c ausf, \c einf, \c synt, \c rest and \c
+   * winplot.par into its current working directory. Concurrent calex
+   * processes sharing a working directory therefore clobber each other's
+   * files. A scratch directory provides a private working directory for
+   * exactly one calex run. It is created below a configurable root
+   * directory, preferably located on a \c tmpfs such as \c /dev/shm, so that
+   * no disk metadata traffic is caused.
+   *
+   * Directory names are deterministic and composed of a prefix, the process
+   * id, a per-thread slot number and a per-thread sequence number, e.g. \c
+   * calex-4711-t3-42. The input and output signal files of calex are made
+   * available within the scratch directory by means of symbolic links (see
+   * ScratchDirectory::link).
+   *
+   * The directory and all of its contents are removed in one pass on
+   * destruction (or on ScratchDirectory::remove). Subdirectories are not
+   * supported since calex does not create any.
+   */
+  class ScratchDirectory
+  {
+    public:
+      /*!
+       * constructor - creates the scratch directory
+       *
+       * \param root Root directory scratch directories are created in.
+       * \param prefix Prefix of the scratch directory name.
+       */
+      ScratchDirectory(std::string const& root,
+          std::string const& prefix="calex");
+      //! destructor - removes the scratch directory
+      ~ScratchDirectory();
+      //! query function for the path of the scratch directory
+      std::string const& get_path() const { return Mpath; }
+      /*!
+       * create a symbolic link within the scratch directory
+       *
+       * \param target File the link points to. Relative paths are resolved
+       * with respect to the current working directory of the caller.
+       * \param name Name of the link within the scratch directory.
+       */
+      void link(std::string const& target, std::string const& name) const;
+      //! remove the scratch directory and its contents
+      void remove();
+
+    private:
+      //! copying is not allowed
+      ScratchDirectory(ScratchDirectory const&);
+      ScratchDirectory& operator=(ScratchDirectory const&);
+
+    private:
+      //! path of the scratch directory
+      std::string Mpath;
+      //! flag if directory still exists
+      bool Mexists;
+
+  }; // class ScratchDirectory
+
+  /*=========================================================================*/
+  /*!
+   * Calex parameter file of a single calex run outside a scratch directory.
+   *
+   * The file is removed on destruction (or on ParameterFile::remove) such
+   * that it does not remain in the working directory if the run is
+   * abandoned before completion, e.g. if spawning calex fails.
+   */
+  class ParameterFile
+  {
+    public:
+      /*!
+       * constructor - names the file by the thread ID and a per-thread
+       * sequence number, e.g. \c calex-7f3a2b4c8700-42.par
+       */
+      ParameterFile();
+      /*!
+       * constructor
+       *
+       * \param path Path of the parameter file. The file need not exist
+       * yet.
+       */
+      explicit ParameterFile(std::string const& path);
+      //! destructor - removes the file unless removed before
+      ~ParameterFile();
+      //! query function for the path of the parameter file
+      std::string const& get_path() const { return Mpath; }
+      //! remove the parameter file
+      void remove();
+
+    private:
+      //! copying is not allowed
+      ParameterFile(ParameterFile const&);
+      ParameterFile& operator=(ParameterFile const&);
+
+    private:
+      //! path of the parameter file
+      std::string Mpath;
+      //! flag if the file was not removed yet
+      bool Mexists;
+
+  }; // class ParameterFile
+
+  /*=========================================================================*/
+  /*!
+   * Convert a path into an absolute path.
+   *
+   * \param path Relative or absolute path.
+   *
+   * \return absolute path
+   */
+  std::string absolutePath(std::string const& path);
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+#endif // include guard
+
+/* ----- END OF scratchdir.h  ----- */
@@ -0,0 +1,242 @@
+/*! \file snapshot.cc
+ * \brief Implementation of immutable snapshots of calex configurations.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Implementation of immutable snapshots of calex configurations.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  Compile the parameter file into a template with value
+ *                    slots patched in place.
+ * 17/10/2026   V0.3  Snapshots of subgrids fixing grid system parameters.
+ * 17/10/2026   V0.4  Patch value slots independently of the C locale.
+ *
+ * ============================================================================
+ */
+
+
+#include <sstream>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <unistd.h>
+#include <fcntl.h>
+#include <calexxx/snapshot.h>
+#include <calexxx/systemparameter.h>
+
+namespace calex
+{
+  namespace
+  {
+    //! width of the value field of a system parameter line
+    const size_t CALEX_VALUE_WIDTH = 12;
+    //! offset of the value field within a system parameter line
+    const size_t CALEX_VALUE_OFFSET = 5;
+  } // namespace (unnamed)
+
+  /*=========================================================================*/
+  ConfigSnapshot::ConfigSnapshot(CalexConfig const& config) :
+    Mcomment(config.Mcomment), Minfile(config.Minfile),
+    Moutfile(config.Moutfile), Mdimensions(0)
+  {
+    collect(config);
+    compile();
+  }
+
+  /*-------------------------------------------------------------------------*/
+  ConfigSnapshot::ConfigSnapshot(CalexConfig const& config,
+      std::vector<unsigned int> const& coordinates,
+      std::vector<double> const& fixed) :
+    Mcomment(config.Mcomment), Minfile(config.Minfile),
+    Moutfile(config.Moutfile), Mdimensions(0)
+  {
+    collect(config);
+    CALEX_assert(fixed.size() == Mdimensions &&
+        coordinates.size() <= Mdimensions, "Invalid subgrid configuration.");
+    // subgrid coordinate of every coordinate of the parameter space
+    std::vector<int> map(Mdimensions, -1);
+    for (size_t j = 0; j < coordinates.size(); ++j)
+    {
+      CALEX_assert(coordinates[j] < Mdimensions && -1 == map[coordinates[j]],
+          "Invalid subgrid configuration.");
+      map[coordinates[j]] = j;
+    }
+    for (auto it(Mentries.begin()); it != Mentries.end(); ++it)
+    {
+      if (it->Mcoordinate < 0) { continue; }
+      CALEX_assert(static_cast<unsigned int>(it->Mcoordinate) < Mdimensions,
+          "Parameters not synchronized.");
+      // grid system parameters fixed by the subgrid become constants
+      if (-1 == map[it->Mcoordinate]) { it->Mval = fixed[it->Mcoordinate]; }
+      it->Mcoordinate = map[it->Mcoordinate];
+    }
+    Mdimensions = coordinates.size();
+    compile();
+  }
+
+  /*-------------------------------------------------------------------------*/
+  void ConfigSnapshot::collect(CalexConfig const& config)
+  {
+    CALEX_assert(config.Mamp && config.Mdel && config.Msub && config.Mtil,
+        "System parameters not assigned.");
+    std::ostringstream oss;
+    config.writeControlParameters(oss);
+    std::string prefix(oss.str());
+    append(prefix, *config.Mamp);
+    append(prefix, *config.Mdel);
+    append(prefix, *config.Msub);
+    append(prefix, *config.Mtil);
+    prefix = "\n";
+    auto const& params(config.MsystemParameters);
+    for (auto cit(params.cbegin()); cit != params.cend(); ++cit)
+    {
+      append(prefix, **cit);
+    }
+    // first order subsystems are written before second order subsystems
+    auto const& subsystems(config.MsubSystems);
+    for (unsigned int order = 1; order <= 2; ++order)
+    {
+      for (auto cit(subsystems.cbegin()); cit != subsystems.cend(); ++cit)
+      {
+        if (order != (*cit)->get_order()) { continue; }
+        std::ostringstream header;
+        header << **cit;
+        // the subsystem's type and order precede its system parameters
+        prefix += header.str().substr(0, header.str().find('\n')+1);
+        append(prefix, *(*cit)->get_per());
+        if (2 == order) { append(prefix, *(*cit)->get_dmp()); }
+        prefix = "\n";
+      }
+    }
+    Msuffix = prefix+"end\n";
+  } // function ConfigSnapshot::collect
+
+  /*-------------------------------------------------------------------------*/
+  void ConfigSnapshot::compile()
+  {
+    // every coordinate must be assigned to exactly one grid system parameter
+    std::vector<bool> assigned(Mdimensions, false);
+    for (auto cit(Mentries.cbegin()); cit != Mentries.cend(); ++cit)
+    {
+      if (cit->Mcoordinate < 0) { continue; }
+      CALEX_assert(static_cast<unsigned int>(cit->Mcoordinate) < Mdimensions
+          && ! assigned[cit->Mcoordinate], "Parameters not synchronized.");
+      assigned[cit->Mcoordinate] = true;
+    }
+
+    std::ostringstream oss;
+    for (auto cit(Mentries.cbegin()); cit != Mentries.cend(); ++cit)
+    {
+      oss << cit->Mprefix;
+      if (cit->Mcoordinate >= 0)
+      {
+        Slot slot;
+        slot.Moffset = static_cast<size_t>(oss.tellp())+CALEX_VALUE_OFFSET;
+        slot.Mcoordinate = cit->Mcoordinate;
+        Mslots.push_back(slot);
+      }
+      // the value of a slot always is patched
+      writeSystemParameter(oss, cit->Mnam,
+          cit->Mcoordinate >= 0 ? 0. : cit->Mval, cit->Munc);
+    }
+    oss << Msuffix;
+    Mbody = oss.str();
+  } // function ConfigSnapshot::compile
+
+  /*-------------------------------------------------------------------------*/
+  void ConfigSnapshot::append(std::string& prefix,
+      SystemParameter const& param)
+  {
+    Entry entry;
+    entry.Mprefix = prefix;
+    entry.Mnam = param.get_nam();
+    entry.Mval = param.get_val();
+    entry.Munc = param.get_unc();
+    entry.Mcoordinate = -1;
+    if (param.is_gridSystemParameter())
+    {
+      entry.Mcoordinate = param.get_coordinateId();
+      CALEX_assert(entry.Mcoordinate >= 0, "Parameters not synchronized.");
+      ++Mdimensions;
+    }
+    Mentries.push_back(entry);
+    prefix.clear();
+  }
+
+  /*-------------------------------------------------------------------------*/
+  size_t ConfigSnapshot::writeHeader(std::string& buffer,
+      std::string const& infile, std::string const& outfile) const
+  {
+    static const char input[] = "'  input to seismo (file name)\n'";
+    static const char output[] = "'  output from seismo (file name)\n\n";
+    buffer.clear();
+    buffer.reserve(Mcomment.size()+infile.size()+outfile.size()+
+        sizeof(input)+sizeof(output)+Mbody.size()+3);
+    buffer.append(Mcomment).append("\n\n'").append(infile).append(input)
+      .append(outfile).append(output);
+    size_t const body = buffer.size();
+    buffer.append(Mbody);
+    return body;
+  } // function ConfigSnapshot::writeHeader
+
+  /*-------------------------------------------------------------------------*/
+  bool ConfigSnapshot::patch(char* slot, double const value)
+  {
+    // identical to the formatting of calex::writeSystemParameter
+    char field[64];
+    int const n = formatClassic(field, sizeof(field), "%12.6f", value);
+    if (CALEX_VALUE_WIDTH != static_cast<size_t>(n)) { return false; }
+    memcpy(slot, field, CALEX_VALUE_WIDTH);
+    return true;
+  } // function ConfigSnapshot::patch
+
+  /*-------------------------------------------------------------------------*/
+  void ConfigSnapshot::writeBuffer(std::string const& path,
+      std::string const& buffer)
+  {
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+        0644);
+    CALEX_assert(-1 != fd, "Error while opening calex parameter file.");
+    char const* data = buffer.data();
+    size_t left = buffer.size();
+    while (left > 0)
+    {
+      ssize_t n = ::write(fd, data, left);
+      if (-1 == n && EINTR == errno) { continue; }
+      if (-1 == n) { close(fd); }
+      CALEX_assert(-1 != n, "Error while writing calex parameter file.");
+      data += n;
+      left -= n;
+    }
+    CALEX_assert(0 == close(fd), "Error while writing calex parameter file.");
+  } // function ConfigSnapshot::writeBuffer
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+/* ----- END OF snapshot.cc  ----- */
@@ -0,0 +1,325 @@
+/*! \file snapshot.h
+ * \brief Declaration of immutable snapshots of calex configurations.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Declaration of immutable snapshots of calex configurations.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  Compile the parameter file into a template with value
+ *                    slots patched in place.
+ * 17/10/2026   V0.3  Snapshots of subgrids fixing grid system parameters.
+ *
+ * ============================================================================
+ */
+
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <calexxx/calexconfig.h>
+#include <calexxx/systemparameter.h>
+#include <calexxx/error.h>
+
+#ifndef _CALEX_SNAPSHOT_H_
+#define _CALEX_SNAPSHOT_H_
+
+namespace calex
+{
+  /*=========================================================================*/
+  /*!
+   * Immutable snapshot of a calex configuration.
+   *
+   * Updating calex::CalexConfig with the coordinates of a node modifies the
+   * values of the shared calex::GridSystemParameter instances. Threads
+   * visiting the parameter space therefore had to serialize updating the
+   * configuration and writing the parameter file. A snapshot instead is
+   * frozen once (see CalexConfig::freeze) and renders the parameter file of
+   * a node from its constant entries and the node's coordinates, which
+   * overlay the values of grid system parameters. Any number of threads may
+   * render parameter files from the same snapshot concurrently.
+   *
+   * The parameter files rendered are identical to the ones written by
+   * CalexConfig::write after CalexConfig::update had been called with the
+   * same coordinates.
+   *
+   * From V0.2 the snapshot additionally is compiled into a byte template of
+   * the parameter file. Only the fixed-width value fields of grid system
+   * parameters (slots) change between nodes. ConfigSnapshot::render copies
+   * the template and patches the slots in place, ConfigSnapshot::writeFile
+   * passes the result to a single \c write call. Values not fitting into
+   * their slot are rendered by ConfigSnapshot::writeRelocated instead.
+   *
+   * From V0.3 a snapshot may be frozen for a subgrid of the parameter space
+   * (see CalexConfig::get_snapshot). The coordinates of the subgrid's nodes
+   * then overlay only the grid system parameters the subgrid varies. Grid
+   * system parameters fixed by the subgrid are rendered as constants.
+   */
+  class ConfigSnapshot
+  {
+    public:
+      //! system parameter line of the calex parameter file
+      struct Entry
+      {
+        //! constant text preceding the system parameter line
+        std::string Mprefix;
+        //! identifier of system parameter
+        std::string Mnam;
+        //! value of a constant system parameter
+        double Mval;
+        //! uncertainty of system parameter
+        double Munc;
+        //! coordinate id of a grid system parameter, -1 otherwise
+        int Mcoordinate;
+      }; // struct Entry
+
+      /*!
+       * constructor - freezes the configuration
+       *
+       * \param config calex configuration
+       */
+      explicit ConfigSnapshot(CalexConfig const& config);
+      /*!
+       * constructor - freezes the configuration for a subgrid
+       *
+       * \param config synchronized calex configuration
+       * \param coordinates coordinate ids of the parameter space the
+       * coordinates of the subgrid correspond to
+       * \param fixed coordinates of the parameter space providing the values
+       * of grid system parameters not varied by the subgrid
+       */
+      ConfigSnapshot(CalexConfig const& config,
+          std::vector<unsigned int> const& coordinates,
+          std::vector<double> const& fixed);
+      //! query function for filename of the calibration signal
+      std::string const& get_infile() const { return Minfile; }
+      //! query function for filename of the seismometer output signal
+      std::string const& get_outfile() const { return Moutfile; }
+      //! query function for the number of coordinates of a node
+      unsigned int get_dimensions() const { return Mdimensions; }
+      //! query function for the system parameter lines
+      std::vector<Entry> const& get_entries() const { return Mentries; }
+      /*!
+       * write the parameter file of a node
+       *
+       * \param os output stream
+       * \param coordinates coordinates of the node
+       */
+      template <typename Ctype>
+      void write(std::ostream& os,
+          std::vector<Ctype> const& coordinates) const
+      { writeRelocated(os, coordinates, Minfile, Moutfile); }
+      /*!
+       * write the parameter file of a node referring to other signal files
+       *
+       * \param os output stream
+       * \param coordinates coordinates of the node
+       * \param infile filename of the calibration signal
+       * \param outfile filename of the seismometer output signal
+       */
+      template <typename Ctype>
+      void writeRelocated(std::ostream& os,
+          std::vector<Ctype> const& coordinates, std::string const& infile,
+          std::string const& outfile) const;
+      /*!
+       * system parameter values of a node in the order they are written to
+       * the calex parameter file
+       *
+       * \param coordinates coordinates of the node
+       * \param names names of the values (optional)
+       *
+       * \return system parameter values
+       */
+      template <typename Ctype>
+      std::vector<double> values(std::vector<Ctype> const& coordinates,
+          std::vector<std::string>* names=0) const;
+      /*!
+       * render the parameter file of a node by patching the template
+       *
+       * \param buffer buffer receiving the parameter file
+       * \param coordinates coordinates of the node
+       * \param infile filename of the calibration signal
+       * \param outfile filename of the seismometer output signal
+       */
+      template <typename Ctype>
+      void render(std::string& buffer, std::vector<Ctype> const& coordinates,
+          std::string const& infile, std::string const& outfile) const;
+      /*!
+       * write the parameter file of a node to disk by a single \c write call
+       *
+       * \param path path of the parameter file
+       * \param coordinates coordinates of the node
+       * \param infile filename of the calibration signal
+       * \param outfile filename of the seismometer output signal
+       */
+      template <typename Ctype>
+      void writeFile(std::string const& path,
+          std::vector<Ctype> const& coordinates, std::string const& infile,
+          std::string const& outfile) const;
+
+    private:
+      //! value field of a grid system parameter within the template
+      struct Slot
+      {
+        //! offset of the field within ConfigSnapshot::Mbody
+        size_t Moffset;
+        //! coordinate id of the grid system parameter
+        int Mcoordinate;
+      }; // struct Slot
+
+      //! collect the entries of the configuration
+      void collect(CalexConfig const& config);
+      //! check the coordinate ids and compile the template
+      void compile();
+      /*!
+       * write the header of the parameter file into a buffer
+       *
+       * \return offset of the body within the buffer
+       */
+      size_t writeHeader(std::string& buffer, std::string const& infile,
+          std::string const& outfile) const;
+      /*!
+       * format a value into its slot
+       *
+       * \return false if the value does not fit into the slot
+       */
+      static bool patch(char* slot, double const value);
+      //! write a buffer to a file
+      static void writeBuffer(std::string const& path,
+          std::string const& buffer);
+
+      //! value of an entry with respect to the coordinates of a node
+      template <typename Ctype>
+      double value(Entry const& entry,
+          std::vector<Ctype> const& coordinates) const
+      {
+        return entry.Mcoordinate < 0 ? entry.Mval :
+          static_cast<double>(coordinates[entry.Mcoordinate]);
+      }
+      //! append a system parameter entry
+      void append(std::string& prefix, SystemParameter const& param);
+
+    private:
+      //! header line of calex parameter file
+      std::string Mcomment;
+      //! filename of the calibration signal
+      std::string Minfile;
+      //! filename of the seismometer output signal
+      std::string Moutfile;
+      //! number of grid system parameters
+      unsigned int Mdimensions;
+      //! system parameter lines
+      std::vector<Entry> Mentries;
+      //! constant text following the last system parameter line
+      std::string Msuffix;
+      //! template of the parameter file following the signal filenames
+      std::string Mbody;
+      //! value slots within the template
+      std::vector<Slot> Mslots;
+
+  }; // class ConfigSnapshot
+
+  /*=========================================================================*/
+  template <typename Ctype>
+  void ConfigSnapshot::writeRelocated(std::ostream& os,
+      std::vector<Ctype> const& coordinates, std::string const& infile,
+      std::string const& outfile) const
+  {
+    CALEX_assert(coordinates.size() == Mdimensions,
+        "Invalid parameter configuration.");
+    os << Mcomment << "\n\n"
+      << "'" << infile << "'  input to seismo (file name)\n"
+      << "'" << outfile << "'  output from seismo (file name)\n\n";
+    for (auto cit(Mentries.cbegin()); cit != Mentries.cend(); ++cit)
+    {
+      os << cit->Mprefix;
+      writeSystemParameter(os, cit->Mnam, value(*cit, coordinates),
+          cit->Munc);
+    }
+    os << Msuffix;
+    os.flush();
+  } // function ConfigSnapshot::writeRelocated
+
+  /*-------------------------------------------------------------------------*/
+  template <typename Ctype>
+  std::vector<double> ConfigSnapshot::values(
+      std::vector<Ctype> const& coordinates,
+      std::vector<std::string>* names) const
+  {
+    CALEX_assert(coordinates.size() == Mdimensions,
+        "Invalid parameter configuration.");
+    std::vector<double> vals;
+    vals.reserve(Mentries.size());
+    for (auto cit(Mentries.cbegin()); cit != Mentries.cend(); ++cit)
+    {
+      vals.push_back(value(*cit, coordinates));
+      if (names) { names->push_back(cit->Mnam); }
+    }
+    return vals;
+  } // function ConfigSnapshot::values
+
+  /*-------------------------------------------------------------------------*/
+  template <typename Ctype>
+  void ConfigSnapshot::render(std::string& buffer,
+      std::vector<Ctype> const& coordinates, std::string const& infile,
+      std::string const& outfile) const
+  {
+    CALEX_assert(coordinates.size() == Mdimensions,
+        "Invalid parameter configuration.");
+    size_t const body = writeHeader(buffer, infile, outfile);
+    for (auto cit(Mslots.cbegin()); cit != Mslots.cend(); ++cit)
+    {
+      if (! patch(&buffer[body+cit->Moffset],
+            static_cast<double>(coordinates[cit->Mcoordinate])))
+      {
+        // value too wide for its slot
+        std::ostringstream oss;
+        writeRelocated(oss, coordinates, infile, outfile);
+        buffer = oss.str();
+        return;
+      }
+    }
+  } // function ConfigSnapshot::render
+
+  /*-------------------------------------------------------------------------*/
+  template <typename Ctype>
+  void ConfigSnapshot::writeFile(std::string const& path,
+      std::vector<Ctype> const& coordinates, std::string const& infile,
+      std::string const& outfile) const
+  {
+    std::string buffer;
+    render(buffer, coordinates, infile, outfile);
+    writeBuffer(path, buffer);
+  } // function ConfigSnapshot::writeFile
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+#endif // include guard
+
+/* ----- END OF snapshot.h  ----- */
@@ -0,0 +1,204 @@
+/*! \file spoolwatcher.cc
+ * \brief Implementation of a watcher of a calex output spool directory.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Implementation of a watcher ingesting calex output files from a
+ *          spool directory.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  Report if the files are known to be closed.
+ *
+ * ============================================================================
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <calexxx/spoolwatcher.h>
+#include <calexxx/error.h>
+
+namespace calex
+{
+  namespace
+  {
+    //! size of the buffer inotify events are read into
+    const size_t CALEX_EVENT_BUFFER = 65536;
+  } // namespace (unnamed)
+
+  /*=========================================================================*/
+  SpoolWatcher::SpoolWatcher(std::string const& directory,
+      std::string const& state_path, std::string const& suffix) :
+    Mdirectory(directory), Msuffix(suffix), Mfd(-1), MstateFd(-1)
+  {
+    Mfd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    CALEX_assert(-1 != Mfd, "Error while initializing inotify.");
+    if (-1 == inotify_add_watch(Mfd, Mdirectory.c_str(),
+          IN_CLOSE_WRITE | IN_MOVED_TO | IN_ONLYDIR))
+    {
+      close(Mfd);
+      CALEX_abort("Error while watching spool directory.");
+    }
+
+    // read the names of the files ingested by previous runs
+    MstateFd = open(state_path.c_str(), O_RDWR | O_CREAT | O_APPEND |
+        O_CLOEXEC, 0644);
+    if (-1 == MstateFd)
+    {
+      close(Mfd);
+      CALEX_abort("Error while opening state file.");
+    }
+    std::string state;
+    char chunk[CALEX_EVENT_BUFFER];
+    ssize_t n;
+    while (0 != (n = pread(MstateFd, chunk, sizeof(chunk), state.size())))
+    {
+      if (-1 == n && EINTR == errno) { continue; }
+      if (-1 == n)
+      {
+        close(Mfd);
+        close(MstateFd);
+        CALEX_abort("Error while reading state file.");
+      }
+      state.append(chunk, n);
+    }
+    size_t begin = 0;
+    for (size_t end; std::string::npos != (end = state.find('\n', begin));
+        begin = end+1)
+    {
+      if (end > begin) { Mingested.insert(state.substr(begin, end-begin)); }
+    }
+  }
+
+  /*-------------------------------------------------------------------------*/
+  SpoolWatcher::~SpoolWatcher()
+  {
+    if (-1 != Mfd) { close(Mfd); }
+    if (-1 != MstateFd) { close(MstateFd); }
+  }
+
+  /*-------------------------------------------------------------------------*/
+  bool SpoolWatcher::accepts(std::string const& name) const
+  {
+    return name.size() > Msuffix.size() &&
+      0 == name.compare(name.size()-Msuffix.size(), Msuffix.size(), Msuffix) &&
+      ! isIngested(name);
+  } // function SpoolWatcher::accepts
+
+  /*-------------------------------------------------------------------------*/
+  void SpoolWatcher::scan(std::vector<std::string>& names) const
+  {
+    names.clear();
+    DIR* dir = opendir(Mdirectory.c_str());
+    CALEX_assert(0 != dir, "Error while opening spool directory.");
+    struct dirent* entry;
+    while (0 != (entry = readdir(dir)))
+    {
+      if (DT_REG != entry->d_type && DT_UNKNOWN != entry->d_type) { continue; }
+      std::string name(entry->d_name);
+      if (accepts(name)) { names.push_back(name); }
+    }
+    closedir(dir);
+    std::sort(names.begin(), names.end());
+  } // function SpoolWatcher::scan
+
+  /*-------------------------------------------------------------------------*/
+  bool SpoolWatcher::wait(std::vector<std::string>& names, int const timeout)
+  {
+    names.clear();
+    struct pollfd pfd;
+    pfd.fd = Mfd;
+    pfd.events = POLLIN;
+    int const ready = poll(&pfd, 1, timeout);
+    if (-1 == ready && EINTR == errno) { return true; }
+    CALEX_assert(-1 != ready, "Error while waiting for inotify events.");
+    if (0 == ready) { return true; }
+
+    // a file closed several times is reported once
+    std::set<std::string> reported;
+    bool overflow = false;
+    alignas(struct inotify_event) char buffer[CALEX_EVENT_BUFFER];
+    for (;;)
+    {
+      ssize_t n = read(Mfd, buffer, sizeof(buffer));
+      if (-1 == n && EINTR == errno) { continue; }
+      if (-1 == n && EAGAIN == errno) { break; }
+      CALEX_assert(n > 0, "Error while reading inotify events.");
+      for (char* p = buffer; p < buffer+n; )
+      {
+        struct inotify_event const* event =
+          reinterpret_cast<struct inotify_event const*>(p);
+        CALEX_assert(! (event->mask & IN_IGNORED),
+            "Spool directory is no longer watched.");
+        if (event->mask & IN_Q_OVERFLOW) { overflow = true; }
+        if (event->len && ! (event->mask & IN_ISDIR))
+        {
+          std::string name(event->name);
+          if (accepts(name) && reported.insert(name).second)
+          {
+            names.push_back(name);
+          }
+        }
+        p += sizeof(struct inotify_event)+event->len;
+      }
+    }
+    if (overflow) { scan(names); }
+    return ! overflow;
+  } // function SpoolWatcher::wait
+
+  /*-------------------------------------------------------------------------*/
+  void SpoolWatcher::commit(std::vector<std::string> const& names)
+  {
+    if (names.empty()) { return; }
+    std::string lines;
+    for (auto cit(names.cbegin()); cit != names.cend(); ++cit)
+    {
+      lines += *cit+"\n";
+    }
+    size_t done = 0;
+    while (done < lines.size())
+    {
+      ssize_t n = write(MstateFd, lines.data()+done, lines.size()-done);
+      if (-1 == n && EINTR == errno) { continue; }
+      CALEX_assert(n > 0, "Error while writing state file.");
+      done += n;
+    }
+    CALEX_assert(0 == fdatasync(MstateFd),
+        "Error while synchronizing state file.");
+    Mingested.insert(names.begin(), names.end());
+  } // function SpoolWatcher::commit
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+/* ----- END OF spoolwatcher.cc  ----- */
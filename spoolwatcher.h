@@ -0,0 +1,160 @@
+/*! \file spoolwatcher.h
+ * \brief Declaration of a watcher of a calex output spool directory.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Declaration of a watcher ingesting calex output files from a
+ *          spool directory.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  Report if the files are known to be closed.
+ *
+ * ============================================================================
+ */
+
+#include <string>
+#include <vector>
+#include <set>
+#include <calexxx/error.h>
+
+#ifndef _CALEX_SPOOLWATCHER_H_
+#define _CALEX_SPOOLWATCHER_H_
+
+namespace calex
+{
+  /*=========================================================================*/
+  /*!
+   * Watcher of a spool directory calex output files are dropped into.
+   *
+   * The directory is watched by \c inotify. A file is reported once it was
+   * closed after writing (\c IN_CLOSE_WRITE) or moved into the directory
+   * (\c IN_MOVED_TO). Only files with the suffix passed are considered.
+   *
+   * The names of the files ingested are appended to a state file by
+   * SpoolWatcher::commit. A watcher constructed later with the same state
+   * file does not report these files again. Commit a file only after its
+   * result data was written to the output sink: a crash in between then
+   * leads to a file ingested twice but never to a file lost.
+   *
+   * Usage:
+   * \code
+   * calex::SpoolWatcher watcher("spool", "spool.state");
+   * std::vector<std::string> names;
+   * watcher.scan(names);
+   * while (! stop)
+   * {
+   *   for (auto cit(names.cbegin()); cit != names.cend(); ++cit)
+   *   {
+   *     ingest(watcher.path(*cit));
+   *   }
+   *   sink.flush();
+   *   watcher.commit(names);
+   *   watcher.wait(names);
+   * }
+   * \endcode
+   */
+  class SpoolWatcher
+  {
+    public:
+      /*!
+       * constructor
+       *
+       * The directory is watched from construction on such that no file is
+       * missed between SpoolWatcher::scan and SpoolWatcher::wait.
+       *
+       * \param directory spool directory
+       * \param state_path path of the state file (created if not existing)
+       * \param suffix suffix of the files to be ingested
+       */
+      SpoolWatcher(std::string const& directory, std::string const& state_path,
+          std::string const& suffix=".out");
+      //! destructor
+      ~SpoolWatcher();
+      //! query function for the path of a file within the spool directory
+      std::string path(std::string const& name) const
+      { return Mdirectory+"/"+name; }
+      /*!
+       * collect the files within the spool directory not ingested yet
+       *
+       * \param names names of the files in lexicographical order
+       */
+      void scan(std::vector<std::string>& names) const;
+      /*!
+       * wait for files closed within or moved into the spool directory
+       *
+       * If events were lost (\c IN_Q_OVERFLOW) the directory is scanned.
+       *
+       * \param names names of the files not ingested yet (empty if the
+       * timeout expired or a signal was caught)
+       * \param timeout timeout in milliseconds (-1: infinite)
+       *
+       * \return true if all files were reported as closed, false if the
+       * directory was scanned (files may still be written then)
+       */
+      bool wait(std::vector<std::string>& names, int const timeout=-1);
+      /*!
+       * record files as ingested within the state file
+       *
+       * The state file is synchronized to disk before returning.
+       *
+       * \param names names of the files ingested
+       */
+      void commit(std::vector<std::string> const& names);
+      //! check if a file was ingested already
+      bool isIngested(std::string const& name) const
+      { return Mingested.count(name) > 0; }
+      //! query function for the number of files ingested
+      size_t get_count() const { return Mingested.size(); }
+
+    private:
+      //! copying is not allowed
+      SpoolWatcher(SpoolWatcher const&);
+      SpoolWatcher& operator=(SpoolWatcher const&);
+      //! check if a file is to be ingested
+      bool accepts(std::string const& name) const;
+
+    private:
+      //! spool directory
+      std::string Mdirectory;
+      //! suffix of the files to be ingested
+      std::string Msuffix;
+      //! inotify descriptor
+      int Mfd;
+      //! descriptor of the state file
+      int MstateFd;
+      //! names of the files ingested
+      std::set<std::string> Mingested;
+
+  }; // class SpoolWatcher
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+#endif // include guard
+
+/* ----- END OF spoolwatcher.h  ----- */
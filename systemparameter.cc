@@ -30,6 +30,9 @@
  * 
  * REVISIONS and CHANGES 
  * 16/03/2012  V0.1  Daniel Armbruster
+ * 17/10/2026  V0.2  Provide formatting of a parameter line independent of
+ *                   an instance.
+ * 17/10/2026  V0.3  Format values independently of the C locale.
  * 
  * ============================================================================
  */
@@ -37,6 +40,9 @@
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <cstdio>
+#include <cstdarg>
+#include <locale.h>
 #include <calexxx/systemparameter.h>
 #include <calexxx/error.h>
 
@@ -58,14 +64,36 @@ namespace calex
 
   /*-------------------------------------------------------------------------*/
   void SystemParameter::write(std::ostream& os) const
+  {
+    writeSystemParameter(os, Mnam, Mval, Munc);
+  }
+
+  /*=========================================================================*/
+  void writeSystemParameter(std::ostream& os, std::string const& nam,
+      double const val, double const unc)
   {
     std::stringstream ss;
-    ss << Mnam << "  " << std::setw(12) << std::right << std::fixed << Mval
-      << "  " << std::setw(12) << std::right << std::fixed << Munc;
+    ss << nam << "  " << std::setw(12) << std::right << std::fixed << val
+      << "  " << std::setw(12) << std::right << std::fixed << unc;
     os << ss.str() << std::endl;
   }
 
   /*-------------------------------------------------------------------------*/
+  int formatClassic(char* buffer, size_t const size, char const* format, ...)
+  {
+    // created once and never freed
+    static locale_t const classic = newlocale(LC_ALL_MASK, "C", 0);
+    CALEX_assert(0 != classic, "Error while creating C locale.");
+    locale_t const previous = uselocale(classic);
+    va_list args;
+    va_start(args, format);
+    int const n = vsnprintf(buffer, size, format, args);
+    va_end(args);
+    uselocale(previous);
+    return n;
+  } // function formatClassic
+
+  /*-------------------------------------------------------------------------*/
 
 } // namespace calex
 
@@ -30,12 +30,16 @@
  * 
  * REVISIONS and CHANGES 
  * 16/03/2012  V0.1  Daniel Armbruster
+ * 17/10/2026  V0.2  Provide formatting of a parameter line independent of
+ *                   an instance.
+ * 17/10/2026  V0.3  Format values independently of the C locale.
  * 
  * ============================================================================
  */
  
 #include <string>
 #include <ostream>
+#include <cstddef>
 #include <optimizexx/parameter.h>
 #include <calexxx/error.h>
 
@@ -148,6 +152,34 @@ namespace calex
 
   }; // class SystemParameter
 
+  /*-------------------------------------------------------------------------*/
+  /*!
+   * write a system parameter line of a calex parameter file
+   *
+   * \param os output stream
+   * \param nam identifier of system parameter
+   * \param val value of system parameter
+   * \param unc uncertainty of system parameter
+   */
+  void writeSystemParameter(std::ostream& os, std::string const& nam,
+      double const val, double const unc);
+
+  /*-------------------------------------------------------------------------*/
+  /*!
+   * \c snprintf within the "C" locale
+   *
+   * Formats numbers as the classic C++ locale used by
+   * calex::writeSystemParameter does, i.e. independently of the \c
+   * LC_NUMERIC category the C library was set to (see \c setlocale).
+   *
+   * \param buffer buffer to be written
+   * \param size size of the buffer
+   * \param format format string of \c snprintf
+   *
+   * \return number of characters as returned by \c snprintf
+   */
+  int formatClassic(char* buffer, size_t const size, char const* format, ...);
+
   /*=========================================================================*/
   /*!
    * Class calex::GridSystemParameter which provides a calex
@@ -0,0 +1,203 @@
+/*! \file calexBatchDispatchTest.cc
+ * \brief Test of dispatching the nodes of a grid as a single batch.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Test of dispatching the nodes of a grid as a single batch (see
+ *          calex::CalexApplication::set_batchDispatch). A small grid is
+ *          swept by the calex stand-in calexMock. Every node must be
+ *          computed exactly once although the nodes are visited after the
+ *          grid was dispatched. The executor of the batch must be sized from
+ *          the slots of the concurrency limiter assigned to the application
+ *          which is verified by the peak number of concurrent calexMock
+ *          processes.
+ *
+ *          Usage: calexBatchDispatchTest [CALEXMOCK]
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026  V0.1  Daniel Armbruster
+ *
+ * ============================================================================
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cmath>
+#include <cstdlib>
+#include <cctype>
+#include <dirent.h>
+#include <unistd.h>
+#include <boost/thread.hpp>
+#include <optimizexx/gridsearch.h>
+#include <optimizexx/standardbuilder.h>
+#include <calexxx/calexconfig.h>
+#include <calexxx/calexvisitor.h>
+#include <calexxx/snapshot.h>
+#include <calexxx/engine.h>
+#include <calexxx/limiter.h>
+#include <calexxx/subsystem.h>
+#include <calexxx/systemparameter.h>
+
+typedef opt::Grid<double, calex::CalexResult> Tgrid;
+typedef opt::Node<double, calex::CalexResult> Tnode;
+
+namespace
+{
+  //! number of calexMock child processes of this process
+  unsigned int children()
+  {
+    unsigned int count = 0;
+    DIR* proc = opendir("/proc");
+    if (! proc) { return 0; }
+    while (struct dirent* entry = readdir(proc))
+    {
+      if (! isdigit(entry->d_name[0])) { continue; }
+      std::string const path(std::string("/proc/")+entry->d_name+"/stat");
+      std::ifstream ifs(path.c_str());
+      std::string line;
+      if (! getline(ifs, line)) { continue; }
+      // pid (comm) state ppid ...
+      size_t const close = line.rfind(')');
+      size_t const open = line.find('(');
+      if (std::string::npos == close || std::string::npos == open)
+      {
+        continue;
+      }
+      std::istringstream iss(line.substr(close+1));
+      char state;
+      pid_t ppid;
+      if (iss >> state >> ppid && getpid() == ppid &&
+          "calexMock" == line.substr(open+1, close-open-1))
+      {
+        ++count;
+      }
+    }
+    closedir(proc);
+    return count;
+  } // function children
+
+  /*-------------------------------------------------------------------------*/
+  //! record the peak number of concurrent calexMock processes
+  void monitor(unsigned int* peak)
+  {
+    for (;;)
+    {
+      unsigned int const count = children();
+      if (count > *peak) { *peak = count; }
+      boost::this_thread::sleep(boost::posix_time::milliseconds(5));
+    }
+  } // function monitor
+
+} // namespace
+
+/*===========================================================================*/
+int main(int iargc, char* argv[])
+{
+  std::string program(iargc > 1 ? argv[1] : "./calexMock");
+  // runs overlap such that the executor is saturated
+  setenv("CALEX_MOCK_SLEEP", "0.3", 1);
+
+  calex::CalexConfig config("input.sfe", "output.sfe");
+  config.set_amp(std::shared_ptr<calex::SystemParameter>(
+        new calex::SystemParameter("amp", -41.5, 5.1)));
+  std::shared_ptr<calex::GridSystemParameter> per(
+      new calex::GridSystemParameter("per", 1., "per", 100., 120., 10.));
+  std::shared_ptr<calex::SystemParameter> dmp(
+      new calex::SystemParameter("dmp", 0.7, 0.01));
+  std::shared_ptr<calex::GridSystemParameter> lp(
+      new calex::GridSystemParameter("per", 1., "lp", 10., 20., 5.));
+  config.add_subsystem(std::shared_ptr<calex::CalexSubsystem>(
+        new calex::SecondOrderSubsystem(calex::BP, per, dmp)));
+  config.add_subsystem(std::shared_ptr<calex::CalexSubsystem>(
+        new calex::FirstOrderSubsystem(calex::LP, lp)));
+  opt::GridSearch<double, calex::CalexResult> algo(
+      new opt::StandardParameterSpaceBuilder<double, calex::CalexResult>);
+  config.set_gridSystemParameters<double>(algo);
+  config.synchronize<double>(algo);
+
+  Tgrid grid;
+  std::vector<Tnode*> nodes;
+  for (double p = 100.; p <= 120.; p += 10.)
+  {
+    for (double l = 10.; l <= 20.; l += 5.)
+    {
+      std::vector<double> coordinates(2, 0.);
+      coordinates[per->get_coordinateId()] = p;
+      coordinates[lp->get_coordinateId()] = l;
+      nodes.push_back(new Tnode(coordinates));
+      grid.add(nodes.back());
+    }
+  }
+
+  // the limiter's slots must differ from the default size of the executor
+  unsigned int const cores = calex::availableCores();
+  unsigned int const slots = 2 == cores ? 3 : 2;
+  std::shared_ptr<calex::ConcurrencyLimiter> limiter(
+      new calex::ConcurrencyLimiter(slots));
+
+  calex::CalexApplication<double> app(&config, false, program);
+  app.set_scratchRoot(".");
+  app.set_batchDispatch(true);
+  app.set_concurrencyLimiter(limiter);
+
+  unsigned int peak = 0;
+  boost::thread watcher(boost::bind(&monitor, &peak));
+  grid.accept(app);
+  watcher.interrupt();
+  watcher.join();
+
+  std::cout << "executor: " << slots << " limiter slots, " << cores
+    << " cores, peak of " << peak << " concurrent calex processes"
+    << std::endl;
+
+  // every node computed exactly once with its own result
+  calex::MockEngine<double> engine;
+  std::shared_ptr<calex::ConfigSnapshot const> snapshot(
+      config.get_snapshot());
+  size_t computed = 0;
+  size_t matching = 0;
+  for (auto cit(nodes.cbegin()); cit != nodes.cend(); ++cit)
+  {
+    if ((*cit)->isComputed()) { ++computed; }
+    double const expected = engine.evaluate(config, *snapshot,
+        (*cit)->getCoordinates()).get_rms();
+    if (std::fabs((*cit)->getResultData().get_rms()-expected) < 1.e-6)
+    {
+      ++matching;
+    }
+  }
+  std::cout << "nodes: " << nodes.size() << " computed: " << computed
+    << " matching: " << matching << " calex runs: "
+    << app.get_runStatistics()->get_count() << std::endl;
+
+  return 0;
+} // function main
+
+/* ----- END OF calexBatchDispatchTest.cc  ----- */
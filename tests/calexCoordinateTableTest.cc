@@ -0,0 +1,211 @@
+/*! \file calexCoordinateTableTest.cc
+ * \brief Test of the coordinate table of calex::CalexConfig.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Test of the coordinate table of calex::CalexConfig. Coordinates
+ *          passed to CalexConfig::update must end up in the grid system
+ *          parameters they belong to, also after the configuration was
+ *          synchronized again following a structural change. Removing and
+ *          clearing subsystems must keep the number of active parameters
+ *          and subsystems written to the parameter file consistent and
+ *          discard the state of synchronization if a grid system parameter
+ *          is affected.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026  V0.1  Daniel Armbruster
+ *
+ * ============================================================================
+ */
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <optimizexx/gridsearch.h>
+#include <optimizexx/standardbuilder.h>
+#include <calexxx/calexconfig.h>
+#include <calexxx/snapshot.h>
+#include <calexxx/subsystem.h>
+#include <calexxx/systemparameter.h>
+#include <calexxx/error.h>
+
+typedef opt::GridSearch<double, calex::CalexResult> TgridSearch;
+typedef opt::StandardParameterSpaceBuilder<double, calex::CalexResult>
+  Tbuilder;
+
+namespace
+{
+  std::shared_ptr<calex::GridSystemParameter> grid(std::string const& nam,
+      std::string const& id, double start, double end, double delta)
+  {
+    return std::shared_ptr<calex::GridSystemParameter>(
+        new calex::GridSystemParameter(nam, 0.01, id, start, end, delta));
+  } // function grid
+
+  /*-------------------------------------------------------------------------*/
+  /*!
+   * synchronize the configuration with a new grid search, update it with
+   * distinct coordinates and check every grid system parameter received
+   * the coordinate of its id
+   */
+  std::string check(calex::CalexConfig& config,
+      std::vector<std::shared_ptr<calex::GridSystemParameter>> const& params)
+  {
+    TgridSearch algo(new Tbuilder);
+    config.set_gridSystemParameters<double>(algo);
+    config.synchronize<double>(algo);
+    std::vector<double> coordinates;
+    for (size_t i = 0; i < params.size(); ++i)
+    {
+      coordinates.push_back(100.+i);
+    }
+    config.update<double>(coordinates);
+    bool consistent = true;
+    for (auto cit(params.cbegin()); cit != params.cend(); ++cit)
+    {
+      int const id = (*cit)->get_coordinateId();
+      consistent = consistent && id >= 0 &&
+        static_cast<size_t>(id) < coordinates.size() &&
+        coordinates[id] == (*cit)->get_val();
+    }
+    // the snapshot must render what the updated configuration writes
+    std::ostringstream expected;
+    expected << config;
+    std::string rendered;
+    std::shared_ptr<calex::ConfigSnapshot const> snapshot(
+        config.get_snapshot());
+    snapshot->render(rendered, coordinates, snapshot->get_infile(),
+        snapshot->get_outfile());
+    std::ostringstream oss;
+    oss << params.size() << " coordinates "
+      << (consistent ? "consistent" : "INCONSISTENT") << ", snapshot "
+      << (expected.str() == rendered ? "identical" : "DIFFERENT");
+    return oss.str();
+  } // function check
+
+  /*-------------------------------------------------------------------------*/
+  //! number of active parameters and subsystems written to the file
+  std::string counts(calex::CalexConfig const& config)
+  {
+    std::ostringstream os;
+    os << config;
+    std::istringstream is(os.str());
+    std::ostringstream oss;
+    std::string line;
+    while (std::getline(is, line))
+    {
+      std::istringstream fields(line);
+      std::string value;
+      std::string name;
+      if (fields >> value >> name && fields.eof() &&
+          ("m" == name || "m1" == name || "m2" == name))
+      {
+        oss << name << "=" << value << " ";
+      }
+    }
+    oss << "(active " << config.get_numActiveParameters() << ")";
+    return oss.str();
+  } // function counts
+
+  /*-------------------------------------------------------------------------*/
+  //! check whether the snapshot was discarded
+  std::string discarded(calex::CalexConfig const& config)
+  {
+    try { config.get_snapshot(); }
+    catch (calex::Exception&) { return "discarded"; }
+    return "KEPT";
+  } // function discarded
+
+} // namespace
+
+/*===========================================================================*/
+int main(int iargc, char* argv[])
+{
+  calex::Exception::dont_report_on_construct();
+
+  calex::CalexConfig config("input.sfe", "output.sfe");
+  config.set_amp(std::shared_ptr<calex::SystemParameter>(
+        new calex::SystemParameter("amp", -41.5, 5.1)));
+  std::vector<std::shared_ptr<calex::GridSystemParameter>> params;
+  params.push_back(grid("per", "bp_per", 100., 140., 10.));
+  params.push_back(grid("dmp", "bp_dmp", 0.5, 0.9, 0.1));
+  params.push_back(grid("per", "lp_per", 10., 20., 5.));
+  std::shared_ptr<calex::CalexSubsystem> bp(
+      new calex::SecondOrderSubsystem(calex::BP, params[0], params[1]));
+  std::shared_ptr<calex::CalexSubsystem> lp(
+      new calex::FirstOrderSubsystem(calex::LP, params[2]));
+  config.add_subsystem(bp);
+  config.add_subsystem(lp);
+  std::cout << "synchronized: " << check(config, params) << ", "
+    << counts(config) << std::endl;
+
+  // structural change: the coordinate table must be rebuilt
+  params.push_back(grid("per", "hp_per", 1., 2., 0.5));
+  config.add_subsystem(std::shared_ptr<calex::CalexSubsystem>(
+        new calex::FirstOrderSubsystem(calex::HP, params[3])));
+  std::cout << "grid subsystem added: snapshot " << discarded(config);
+  bool rejected = false;
+  try { config.update<double>(std::vector<double>(3, 0.)); }
+  catch (calex::Exception&) { rejected = true; }
+  std::cout << ", update " << (rejected ? "rejected" : "ACCEPTED")
+    << std::endl;
+  std::cout << "synchronized again: " << check(config, params) << ", "
+    << counts(config) << std::endl;
+
+  // second order subsystem with a constant period but a grid damping
+  std::shared_ptr<calex::SystemParameter> per(
+      new calex::SystemParameter("per", 8., 1.));
+  std::shared_ptr<calex::GridSystemParameter> dmp(
+      grid("dmp", "hp2_dmp", 0.6, 0.8, 0.1));
+  std::shared_ptr<calex::CalexSubsystem> hp2(
+      new calex::SecondOrderSubsystem(calex::HP, per, dmp));
+  config.add_subsystem(hp2);
+  params.push_back(dmp);
+  std::cout << "second order subsystem added: " << check(config, params)
+    << ", " << counts(config) << std::endl;
+  config.remove_subsystem(hp2);
+  params.pop_back();
+  std::cout << "second order subsystem removed: snapshot "
+    << discarded(config) << ", " << counts(config) << std::endl;
+  std::cout << "synchronized again: " << check(config, params) << std::endl;
+
+  // first order subsystem with a grid period
+  config.remove_subsystem(lp);
+  params.erase(params.begin()+2);
+  std::cout << "first order subsystem removed: snapshot "
+    << discarded(config) << ", " << counts(config) << std::endl;
+  std::cout << "synchronized again: " << check(config, params) << std::endl;
+
+  config.clear_subsystems();
+  std::cout << "subsystems cleared: snapshot " << discarded(config) << ", "
+    << counts(config) << std::endl;
+
+  return 0;
+} // function main
+
+/* ----- END OF calexCoordinateTableTest.cc  ----- */
@@ -0,0 +1,133 @@
+/*! \file calexEngineBench.cc
+ * \brief Benchmark of forward engines side by side.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Benchmark of forward engines side by side. Evaluations per second
+ *          of the same calex configuration are measured for every forward
+ *          engine selected on the command line.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <chrono>
+#include <boost/thread.hpp>
+#include <calexxx/engine.h>
+#include <calexxx/parser.h>
+
+namespace
+{
+  //! engine under test
+  typedef calex::ForwardEngine<double> Tengine;
+
+  /* ----------------------------------------------------------------------- */
+  //! worker evaluating the configuration \a n times
+  void worker(Tengine* engine, calex::CalexConfig* config, int n,
+      int* computed)
+  {
+    std::vector<double> coordinates;
+    for (int i = 0; i < n; ++i)
+    {
+      if (engine->evaluate(*config, coordinates).isComputed()) { ++*computed; }
+    }
+  } // function worker
+
+  /* ----------------------------------------------------------------------- */
+  //! measure evaluations per second
+  double measure(Tengine* engine, calex::CalexConfig* config,
+      int evaluations, int threads, int& computed)
+  {
+    std::vector<int> counts(threads, 0);
+    auto start(std::chrono::steady_clock::now());
+    boost::thread_group group;
+    for (int t = 0; t < threads; ++t)
+    {
+      group.create_thread(boost::bind(&worker, engine, config,
+            evaluations/threads, &counts[t]));
+    }
+    group.join_all();
+    std::chrono::duration<double> elapsed(
+        std::chrono::steady_clock::now()-start);
+    computed = 0;
+    for (int t = 0; t < threads; ++t) { computed += counts[t]; }
+    return (evaluations/threads)*threads/elapsed.count();
+  } // function measure
+
+} // namespace (unnamed)
+
+/* ------------------------------------------------------------------------- */
+int main(int iargc, char* argv[])
+{
+  if (iargc > 1 && 0 == strcmp(argv[1], "-h"))
+  {
+    std::cout << "Usage: calexEngineBench [EVALUATIONS [THREADS [PROGRAM "
+      << "[ENGINE ...]]]]" << std::endl
+      << "ENGINE: mock (default) or external" << std::endl;
+    return 0;
+  }
+  int evaluations = iargc > 1 ? atoi(argv[1]) : 1000;
+  int threads = iargc > 2 ? atoi(argv[2]) : 4;
+  std::string program(iargc > 3 ? argv[3] : "calex");
+  std::vector<std::string> engines;
+  for (int i = 4; i < iargc; ++i) { engines.push_back(argv[i]); }
+  if (engines.empty()) { engines.push_back("mock"); }
+
+  // STS-2 like configuration
+  calex::CalexConfig config("input.sfe", "output.sfe");
+  config.set_comment("calex engine benchmark");
+  config.set_amp(std::shared_ptr<calex::SystemParameter>(
+        new calex::SystemParameter("amp", -41.5, 5.1)));
+  config.add_subsystem(calex::parser::secondOrderParser("BP|120|1|0.707|0.01"));
+  config.freeze();
+
+  std::cout << "evaluations: " << evaluations << "  threads: " << threads
+    << "\n" << std::setw(10) << "engine" << std::setw(14) << "eval/s"
+    << std::setw(10) << "computed" << std::endl;
+  for (auto cit(engines.cbegin()); cit != engines.cend(); ++cit)
+  {
+    std::shared_ptr<Tengine> engine(
+        calex::createEngine<double>(*cit, program));
+    int computed = 0;
+    double rate = measure(engine.get(), &config, evaluations, threads,
+        computed);
+    std::cout << std::setw(10) << engine->get_name() << std::fixed
+      << std::setprecision(1) << std::setw(14) << rate << std::setw(10)
+      << computed << std::endl;
+  }
+  return 0;
+} // function main
+
+/* ----- END OF calexEngineBench.cc  ----- */
@@ -0,0 +1,130 @@
+/*! \file calexExecutorTest.cc
+ * \brief Testing the event-driven executor for calex runs.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Testing the event-driven executor for calex runs. Since the calex
+ * program itself may not be available standard system utilities are
+ * launched instead.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 17/10/2026  V0.2  calex exiting normally without final system parameters
+ * 17/10/2026  V0.3  a run failing to launch does not abort the batch
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <vector>
+#include <calexxx/executor.h>
+#include <calexxx/engine.h>
+#include <calexxx/error.h>
+
+int main(int iargc, char* argv[])
+{
+  // cat prints calex output to stdout
+  calex::CalexLauncher launcher_cat("cat");
+  calex::CalexExecutor executor(launcher_cat, 2);
+
+  calex::CalexRun run;
+  run.Mparam = "calex.out";
+  run.MoutPath = "calexExecutorTest.out";
+  run.Mmode = calex::StdoutPipe;
+  run.MrunStatistics.reset(new calex::RunStatistics);
+  int completed = 0;
+  run.Mcompletion = [&completed](calex::CalexResult const& result)
+    { ++completed; };
+
+  std::vector<std::shared_future<calex::CalexResult>> results;
+  for (int i = 0; i < 6; ++i) { results.push_back(executor.submit(run)); }
+  std::cout << "queued: " << executor.get_queued() << std::endl;
+  executor.runOnce(0);
+  std::cout << "in flight: " << executor.get_inFlight() << std::endl;
+  executor.run();
+  std::cout << "completed: " << completed << " recorded: "
+    << run.MrunStatistics->get_count() << std::endl;
+  for (size_t i = 0; i < results.size(); ++i)
+  {
+    std::cout << "run " << i << ": computed="
+      << results[i].get().isComputed() << " rms="
+      << results[i].get().get_rms() << std::endl;
+  }
+
+  // a run exceeding its wall-clock limit
+  calex::CalexLauncher launcher_sleep("sleep");
+  calex::CalexExecutor sleeper(launcher_sleep, 2);
+  calex::CalexRun sleep_run;
+  sleep_run.Mparam = "5";
+  sleep_run.Mlimits = calex::RunLimits(0.2);
+  std::shared_future<calex::CalexResult> timed_out(sleeper.submit(sleep_run));
+  sleeper.run();
+  std::cout << "sleep 5 (limit 0.2 s): timed out="
+    << (calex::TimedOut == timed_out.get().get_status()) << std::endl;
+
+  // echo exits normally but writes no final system parameters
+  calex::CalexLauncher launcher_echo("echo");
+  calex::CalexExecutor echoer(launcher_echo, 2);
+  calex::CalexRun echo_run;
+  echo_run.Mparam = "calex: cannot open file einf";
+  echo_run.MoutPath = "calexExecutorTest.out";
+  echo_run.Mmode = calex::StdoutPipe;
+  echo_run.MbestRms.reset(new calex::BestRms);
+  echo_run.MrunStatistics.reset(new calex::RunStatistics);
+  std::shared_future<calex::CalexResult> failed(echoer.submit(echo_run));
+  echoer.run();
+  std::cout << "echo (executor): exit status=" << failed.get().get_exitStatus()
+    << " failed=" << (calex::Failed == failed.get().get_status())
+    << " best RMS=" << echo_run.MbestRms->get() << std::endl;
+
+  calex::ExternalEngine<double> engine("echo");
+  calex::CalexResult engine_result;
+  echo_run.Mcompletion = [&engine_result](calex::CalexResult const& result)
+    { engine_result = result; };
+  engine.execute(echo_run);
+  std::cout << "echo (engine): exit status=" << engine_result.get_exitStatus()
+    << " failed=" << (calex::Failed == engine_result.get_status())
+    << " best RMS=" << echo_run.MbestRms->get() << std::endl;
+
+  // the link of the output file cannot be created
+  calex::Exception::dont_report_on_construct();
+  calex::CalexExecutor batch(launcher_cat, 1);
+  calex::CalexRun broken(run);
+  broken.MoutPath = "calexExecutorTest.missing/calex.out";
+  int broken_completed = 0;
+  broken.Mcompletion = [&broken_completed](calex::CalexResult const& result)
+    { ++broken_completed; };
+  std::shared_future<calex::CalexResult> broken_result(batch.submit(broken));
+  std::shared_future<calex::CalexResult> next_result(batch.submit(run));
+  batch.run();
+  std::cout << "launch failure: completed=" << broken_completed << " failed="
+    << (calex::Failed == broken_result.get().get_status())
+    << ", next run computed=" << next_result.get().isComputed() << std::endl;
+
+  return 0;
+} // function main
+
+/* ----- END OF calexExecutorTest.cc  ----- */
@@ -0,0 +1,155 @@
+/*! \file calexFlatConfigBench.cc
+ * \brief Benchmark of flat calex configurations.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Benchmark of flat calex configurations. Configurations with
+ *          a number of second-order subsystems are created, updated with
+ *          the coordinates of a node and written into memory. Configurations
+ *          per second are measured for calex::CalexConfig (every system
+ *          parameter allocated separately) and for copies of a
+ *          calex::FlatConfig allocated from a calex::ParameterArena.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 17/10/2026  V0.2  measure patching the precompiled template
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <chrono>
+#include <calexxx/calexconfig.h>
+#include <calexxx/flatconfig.h>
+#include <calexxx/subsystem.h>
+#include <calexxx/systemparameter.h>
+
+namespace
+{
+  //! create a configuration with \a n second-order subsystems
+  std::shared_ptr<calex::CalexConfig> create(int const n,
+      std::vector<std::shared_ptr<calex::SystemParameter>>& grid)
+  {
+    std::shared_ptr<calex::CalexConfig> config(
+        new calex::CalexConfig("input.sfe", "output.sfe"));
+    config->set_comment("calex flat configuration benchmark");
+    config->set_amp(std::shared_ptr<calex::SystemParameter>(
+          new calex::SystemParameter("amp", -41.5, 5.1)));
+    grid.clear();
+    for (int k = 0; k < n; ++k)
+    {
+      std::shared_ptr<calex::SystemParameter> per(
+          new calex::GridSystemParameter("per", 1., "per", 100., 140., 1.,
+            "s", 2*k));
+      std::shared_ptr<calex::SystemParameter> dmp(
+          new calex::GridSystemParameter("dmp", 0.01, "dmp", 0.5, 0.9, 0.01,
+            "", 2*k+1));
+      grid.push_back(per);
+      grid.push_back(dmp);
+      config->add_subsystem(std::shared_ptr<calex::CalexSubsystem>(
+            new calex::SecondOrderSubsystem(calex::BP, per, dmp)));
+    }
+    return config;
+  } // function create
+
+  /* ----------------------------------------------------------------------- */
+  //! coordinates of the \a i-th node
+  void coordinates(int const i, std::vector<double>& coords)
+  {
+    for (size_t j = 0; j < coords.size(); ++j)
+    {
+      coords[j] = j % 2 ? 0.5+1e-5*i : 100.+0.01*i;
+    }
+  } // function coordinates
+
+} // namespace (unnamed)
+
+/* ------------------------------------------------------------------------- */
+int main(int iargc, char* argv[])
+{
+  if (iargc > 1 && 0 == strcmp(argv[1], "-h"))
+  {
+    std::cout << "Usage: calexFlatConfigBench [CONFIGS [SUBSYSTEMS]]"
+      << std::endl;
+    return 0;
+  }
+  int const configs = iargc > 1 ? atoi(argv[1]) : 100000;
+  int const subsystems = iargc > 2 ? atoi(argv[2]) : 4;
+  std::vector<double> coords(2*subsystems);
+  std::vector<std::shared_ptr<calex::SystemParameter>> grid;
+  size_t bytes = 0;
+
+  // configurations made of separately allocated system parameters
+  auto start(std::chrono::steady_clock::now());
+  for (int i = 0; i < configs; ++i)
+  {
+    std::shared_ptr<calex::CalexConfig> config(create(subsystems, grid));
+    coordinates(i, coords);
+    // what calex::CalexConfig::update does
+    for (size_t j = 0; j < coords.size(); ++j) { grid[j]->set_val(coords[j]); }
+    std::ostringstream oss;
+    oss << *config;
+    bytes += oss.str().size();
+  }
+  std::chrono::duration<double> graph(std::chrono::steady_clock::now()-start);
+
+  // copies of a flat configuration
+  calex::ParameterArena arena;
+  calex::FlatConfig prototype(*create(subsystems, grid), arena);
+  size_t const prototype_bytes = arena.get_used();
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < configs; ++i)
+  {
+    calex::FlatConfig config(prototype, arena);
+    coordinates(i, coords);
+    config.update(coords);
+    std::ostringstream oss;
+    oss << config;
+    bytes -= oss.str().size();
+  }
+  std::chrono::duration<double> flat(std::chrono::steady_clock::now()-start);
+
+  std::cout << "configurations: " << configs << ", subsystems: "
+    << subsystems << "\n" << std::fixed << std::setprecision(1)
+    << std::setw(24) << "CalexConfig/s" << std::setw(14)
+    << configs/graph.count() << "\n"
+    << std::setw(24) << "FlatConfig/s" << std::setw(14)
+    << configs/flat.count() << "\n"
+    << std::setw(24) << "arena bytes/config" << std::setw(14)
+    << static_cast<double>(prototype_bytes) << "\n"
+    << std::setw(24) << "output" << std::setw(14)
+    << (0 == bytes ? "identical" : "DIFFERENT") << std::endl;
+  return 0;
+} // function main
+
+/* ----- END OF calexFlatConfigBench.cc  ----- */
@@ -0,0 +1,189 @@
+/*! \file calexFlatConfigTest.cc
+ * \brief Test of flat calex configurations.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Test of flat calex configurations. The parameter files written
+ *          by calex::FlatConfig are compared to the ones written by
+ *          calex::CalexConfig for several coordinates. Copies of flat
+ *          configurations and configurations converted back are checked,
+ *          too. Configurations converted back must not share grid system
+ *          parameters with each other or with the source configuration.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 17/10/2026  V0.2  Test configurations converted back are independent.
+ * 17/10/2026  V0.3  Test writing with LC_NUMERIC set to a comma locale.
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <clocale>
+#include <calexxx/calexconfig.h>
+#include <calexxx/flatconfig.h>
+#include <calexxx/subsystem.h>
+#include <calexxx/systemparameter.h>
+
+
+int main(int iargc, char* argv[])
+{
+  calex::CalexConfig config("input.sfe", "output.sfe");
+  config.set_comment("calex flat configuration test");
+  config.set_amp(std::shared_ptr<calex::SystemParameter>(
+        new calex::SystemParameter("amp", -41.5, 5.1)));
+  config.set_sub(std::shared_ptr<calex::SystemParameter>(
+        new calex::SystemParameter("sub", 0.02, 0.)));
+  config.add_systemParameter(std::shared_ptr<calex::SystemParameter>(
+        new calex::SystemParameter("xyz", 3., 0.)));
+  // grid system parameters with coordinate ids as assigned by synchronizing
+  std::shared_ptr<calex::SystemParameter> per(new calex::GridSystemParameter(
+        "per", 1., "per", 100., 140., 1., "s", 1));
+  std::shared_ptr<calex::SystemParameter> dmp(new calex::GridSystemParameter(
+        "dmp", 0.01, "dmp", 0.5, 0.9, 0.01, "", 0));
+  std::shared_ptr<calex::SystemParameter> lp(new calex::GridSystemParameter(
+        "per", 1., "lp", 10., 20., 1., "s", 2));
+  config.add_subsystem(std::shared_ptr<calex::CalexSubsystem>(
+        new calex::SecondOrderSubsystem(calex::BP, per, dmp)));
+  config.add_subsystem(std::shared_ptr<calex::CalexSubsystem>(
+        new calex::FirstOrderSubsystem(calex::LP, lp)));
+  config.add_subsystem(std::shared_ptr<calex::CalexSubsystem>(
+        new calex::FirstOrderSubsystem(calex::HP,
+          std::shared_ptr<calex::SystemParameter>(
+            new calex::SystemParameter("per", 360., 10.)))));
+
+  calex::ParameterArena arena;
+  calex::FlatConfig flat(config, arena);
+  std::ostringstream expected;
+  std::ostringstream written;
+  expected << config;
+  written << flat;
+  std::string const original(written.str());
+  std::cout << "flat configuration: "
+    << (expected.str() == written.str() ? "identical" : "DIFFERENT")
+    << " (" << flat.get_size() << " system parameters, "
+    << flat.get_dimensions() << " dimensions)" << std::endl;
+
+  double const coords[][3] = {
+    {0.707, 120., 15.},
+    {0.5000005, 99.9999995, -0.0},
+    {-99999.9999999, 123456.5, 17.25}};
+  for (size_t i = 0; i < sizeof(coords)/sizeof(coords[0]); ++i)
+  {
+    std::vector<double> coordinates(coords[i], coords[i]+3);
+    // what calex::CalexConfig::update does
+    dmp->set_val(coordinates[0]);
+    per->set_val(coordinates[1]);
+    lp->set_val(coordinates[2]);
+    expected.str("");
+    std::ostringstream relocated;
+    expected << config;
+    config.writeRelocated(relocated, "in.sfe", "out.sfe");
+
+    calex::FlatConfig copy(flat, arena);
+    copy.update(coordinates);
+    written.str("");
+    std::ostringstream written_relocated;
+    written << copy;
+    copy.writeRelocated(written_relocated, "in.sfe", "out.sfe");
+
+    std::cout << "coordinates " << i << ": update "
+      << (expected.str() == written.str() ? "identical" : "DIFFERENT")
+      << ", relocated "
+      << (relocated.str() == written_relocated.str() ? "identical" :
+          "DIFFERENT") << std::endl;
+  }
+
+  // the C library formatting numbers with a decimal comma
+  char const* locales[] = {"de_DE.UTF-8", "de_DE.utf8", "de_DE",
+    "fr_FR.UTF-8", "fr_FR.utf8", "fr_FR"};
+  bool comma = false;
+  for (size_t i = 0; i < sizeof(locales)/sizeof(locales[0]) && ! comma; ++i)
+  {
+    comma = 0 != setlocale(LC_NUMERIC, locales[i]);
+  }
+  if (comma)
+  {
+    expected.str("");
+    written.str("");
+    expected << config;
+    calex::FlatConfig converted(config, arena);
+    written << converted;
+    std::cout << "comma locale: "
+      << (expected.str() == written.str() ? "identical" : "DIFFERENT")
+      << std::endl;
+    setlocale(LC_NUMERIC, "C");
+  } else
+  {
+    std::cout << "comma locale: not available" << std::endl;
+  }
+
+  // copies are independent of the flat configuration they were copied from
+  written.str("");
+  written << flat;
+  std::cout << "original unchanged: "
+    << (original == written.str() ? "yes" : "NO") << std::endl;
+
+  std::shared_ptr<calex::CalexConfig> restored(flat.toCalexConfig());
+  expected.str("");
+  expected << *restored;
+  std::cout << "converted back: "
+    << (expected.str() == written.str() ? "identical" : "DIFFERENT")
+    << std::endl;
+
+  // modifying a configuration converted back affects neither the source
+  // configuration nor a further configuration converted back
+  std::ostringstream source;
+  source << config;
+  std::shared_ptr<calex::CalexConfig> other(flat.toCalexConfig());
+  restored->get_subsystems()[0]->get_per()->set_val(111.);
+  restored->get_subsystems()[0]->get_dmp()->set_val(0.111);
+  restored->get_subsystems()[1]->get_per()->set_val(11.1);
+  std::ostringstream modified;
+  modified << *restored;
+  std::ostringstream unaffected_source;
+  std::ostringstream unaffected_other;
+  unaffected_source << config;
+  unaffected_other << *other;
+  std::cout << "converted back independently: modified "
+    << (modified.str() != written.str() ? "yes" : "NO") << ", source "
+    << (unaffected_source.str() == source.str() ? "unchanged" : "CHANGED")
+    << ", further conversion "
+    << (unaffected_other.str() == written.str() ? "unchanged" : "CHANGED")
+    << std::endl;
+
+  std::cout << "arena: " << arena.get_used() << " bytes used, "
+    << arena.get_reserved() << " bytes reserved" << std::endl;
+  std::cout << std::endl << flat;
+
+  return 0;
+} // function main
+
+/* ----- END OF calexFlatConfigTest.cc  ----- */
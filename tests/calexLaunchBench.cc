@@ -0,0 +1,140 @@
+/*! \file calexLaunchBench.cc
+ * \brief Benchmark of calex process launch rates depending on host RSS.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Benchmark of calex process launch rates depending on host RSS.
+ *          Launches per second are measured using system(), a direct
+ *          posix_spawn launch and calex::CalexForkServer while the host
+ *          process holds an increasing amount of resident memory. Instead of
+ *          calex the program \c true is launched.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <chrono>
+#include <boost/thread.hpp>
+#include <calexxx/launcher.h>
+#include <calexxx/forkserver.h>
+
+namespace
+{
+  //! launch mode
+  enum Emode { SYSTEM, SPAWN, FORKSERVER };
+
+  /* ----------------------------------------------------------------------- */
+  //! worker launching \a n processes
+  void worker(Emode mode, calex::CalexLauncher const* launcher, int n)
+  {
+    for (int i = 0; i < n; ++i)
+    {
+      if (SYSTEM == mode)
+      {
+        if (0 != system("true >/dev/null 2>&1")) { std::abort(); }
+      }
+      else
+      {
+        launcher->run("");
+      }
+    }
+  } // function worker
+
+  /* ----------------------------------------------------------------------- */
+  //! measure launches per second
+  double measure(Emode mode, calex::CalexLauncher const* launcher,
+      int launches, int threads)
+  {
+    auto start(std::chrono::steady_clock::now());
+    boost::thread_group group;
+    for (int t = 0; t < threads; ++t)
+    {
+      group.create_thread(boost::bind(&worker, mode, launcher,
+            launches/threads));
+    }
+    group.join_all();
+    std::chrono::duration<double> elapsed(
+        std::chrono::steady_clock::now()-start);
+    return (launches/threads)*threads/elapsed.count();
+  } // function measure
+
+} // namespace (unnamed)
+
+/* ------------------------------------------------------------------------- */
+int main(int iargc, char* argv[])
+{
+  if (iargc > 1 && 0 == strcmp(argv[1], "-h"))
+  {
+    std::cout << "Usage: calexLaunchBench [LAUNCHES [THREADS [RSS_MB ...]]]"
+      << std::endl;
+    return 0;
+  }
+  int launches = iargc > 1 ? atoi(argv[1]) : 400;
+  int threads = iargc > 2 ? atoi(argv[2]) : 4;
+  std::vector<size_t> rss;
+  for (int i = 3; i < iargc; ++i) { rss.push_back(atol(argv[i])); }
+  if (rss.empty())
+  {
+    rss.push_back(0); rss.push_back(256); rss.push_back(1024);
+    rss.push_back(4096);
+  }
+
+  // the fork server must be started while the host is still small
+  std::shared_ptr<calex::CalexForkServer> server(new calex::CalexForkServer);
+  server->start();
+  calex::CalexLauncher spawn_launcher("true");
+  calex::CalexLauncher server_launcher("true");
+  server_launcher.set_forkServer(server);
+
+  std::cout << "launches: " << launches << "  threads: " << threads
+    << "\n" << std::setw(10) << "RSS [MB]" << std::setw(14) << "system/s"
+    << std::setw(14) << "spawn/s" << std::setw(14) << "forkserver/s"
+    << std::endl;
+  std::vector<char> ballast;
+  for (auto cit(rss.cbegin()); cit != rss.cend(); ++cit)
+  {
+    // touch every page to make the memory resident
+    ballast.assign(*cit << 20, 1);
+    std::cout << std::setw(10) << *cit << std::fixed << std::setprecision(1)
+      << std::setw(14) << measure(SYSTEM, 0, launches, threads)
+      << std::setw(14) << measure(SPAWN, &spawn_launcher, launches, threads)
+      << std::setw(14) << measure(FORKSERVER, &server_launcher, launches,
+          threads)
+      << std::endl;
+  }
+  return 0;
+} // function main
+
+/* ----- END OF calexLaunchBench.cc  ----- */
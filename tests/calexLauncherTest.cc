@@ -0,0 +1,107 @@
+/*! \file calexLauncherTest.cc
+ * \brief Testing the calex process launcher.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Testing the calex process launcher. Since the calex program
+ * itself may not be available standard system utilities are launched
+ * instead.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 17/10/2026  V0.2  make use of calex::SpawnOptions
+ * 17/10/2026  V0.3  relative program path spawned in a scratch directory
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <string>
+#include <sys/stat.h>
+#include <calexxx/launcher.h>
+#include <calexxx/resultdata.h>
+#include <calexxx/scratchdir.h>
+
+int main(int iargc, char* argv[])
+{
+  // resolve programs once
+  calex::CalexLauncher launcher_true("true");
+  calex::CalexLauncher launcher_false("false");
+  calex::CalexLauncher launcher_cat("cat");
+  std::cout << "resolved: " << launcher_true.get_program() << std::endl;
+  std::cout << "resolved: " << launcher_false.get_program() << std::endl;
+
+  // exit status is reported into the result data
+  calex::CalexResult result_true;
+  result_true.set_exitStatus(launcher_true.run("calex.out"));
+  std::cout << "true:  success="
+    << calex::exitedSuccessfully(result_true.get_exitStatus())
+    << " failed=" << (calex::Failed == result_true.get_status()) << std::endl;
+
+  calex::CalexResult result_false;
+  result_false.set_exitStatus(launcher_false.run("calex.out"));
+  std::cout << "false: success="
+    << calex::exitedSuccessfully(result_false.get_exitStatus())
+    << " failed=" << (calex::Failed == result_false.get_status()) << std::endl;
+
+  // redirect stdout of the child to a file
+  calex::SpawnOptions options;
+  options.Mstdout = "calexLauncherTest.tmp";
+  pid_t pid = launcher_cat.spawn("calex.out", options);
+  std::cout << "cat:   success="
+    << calex::exitedSuccessfully(launcher_cat.wait(pid)) << std::endl;
+  calex::CalexResult result;
+  std::ifstream ifs("calexLauncherTest.tmp");
+  ifs >> result;
+  std::cout << result;
+  std::remove("calexLauncherTest.tmp");
+
+  // a relative program path remains valid within a scratch directory
+  {
+    std::ofstream script("calexLauncherTest.sh");
+    script << "#!/bin/sh\ntest -f \"$1\"\n";
+  }
+  chmod("calexLauncherTest.sh", 0755);
+  calex::CalexLauncher launcher_relative("./calexLauncherTest.sh");
+  std::cout << "relative program absolute: "
+    << ('/' == launcher_relative.get_program()[0]) << std::endl;
+  {
+    calex::ScratchDirectory scratch(".", "calexLauncherTest");
+    scratch.link("calex.out", "calex.out");
+    calex::SpawnOptions scratch_options;
+    scratch_options.Mworkdir = scratch.get_path();
+    pid = launcher_relative.spawn("calex.out", scratch_options);
+    std::cout << "relative program in scratch directory: success="
+      << calex::exitedSuccessfully(launcher_relative.wait(pid)) << std::endl;
+  }
+  std::remove("calexLauncherTest.sh");
+
+  return 0;
+} // function main
+
+/* ----- END OF calexLauncherTest.cc  ----- */
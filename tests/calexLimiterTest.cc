@@ -0,0 +1,87 @@
+/*! \file calexLimiterTest.cc
+ * \brief Testing the concurrency limiter for calex processes.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Testing the concurrency limiter for calex processes. Several threads
+ * compete for a small number of slots.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <atomic>
+#include <boost/thread.hpp>
+#include <calexxx/limiter.h>
+
+namespace
+{
+  std::atomic<unsigned int> running(0);
+  std::atomic<unsigned int> max_running(0);
+
+  //! occupy a slot for a short while
+  void work(calex::ConcurrencyLimiter* limiter)
+  {
+    for (int i = 0; i < 4; ++i)
+    {
+      calex::ConcurrencyLimiter::Slot slot(*limiter);
+      unsigned int n = ++running;
+      unsigned int max = max_running;
+      while (n > max && ! max_running.compare_exchange_weak(max, n)) { }
+      boost::this_thread::sleep(boost::posix_time::milliseconds(5));
+      --running;
+    }
+  }
+} // namespace (unnamed)
+
+int main(int iargc, char* argv[])
+{
+  std::cout << "available cores > 0: " << (calex::availableCores() > 0)
+    << std::endl;
+  std::cout << "processes fitting memory (1 MiB each) > 0: "
+    << (calex::processesFittingMemory(1 << 20) > 0) << std::endl;
+
+  calex::ConcurrencyLimiter limiter(2);
+  boost::thread_group threads;
+  for (int i = 0; i < 8; ++i)
+  {
+    threads.create_thread(boost::bind(&work, &limiter));
+  }
+  threads.join_all();
+
+  std::cout << "slots: " << limiter.get_slots() << " max running: "
+    << max_running << " active: " << limiter.get_active() << std::endl;
+  std::cout << "admissions: " << limiter.get_waitStatistics().get_count()
+    << " max wait > 0: " << (limiter.get_waitStatistics().get_max() > 0)
+    << std::endl;
+
+  return 0;
+} // function main
+
+/* ----- END OF calexLimiterTest.cc  ----- */
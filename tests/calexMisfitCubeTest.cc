@@ -0,0 +1,177 @@
+/*! \file calexMisfitCubeTest.cc
+ * \brief Test of misfit cube files.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Test of misfit cube files. Synthetic results of a
+ *          three-dimensional parameter space are written into a misfit
+ *          cube file which is read again by value, by surface and by
+ *          slice.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 17/10/2026  V0.2  Test rejecting corrupt headers.
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <utility>
+#include <cstdio>
+#include <cstdint>
+#include <calexxx/resultdata.h>
+#include <calexxx/gridaxes.h>
+#include <calexxx/misfitcube.h>
+#include <calexxx/error.h>
+
+namespace
+{
+  /*!
+   * overwrite a header field of a copy of a misfit cube file and check if
+   * opening the copy is rejected
+   */
+  std::string corrupt(char const* path, std::streamoff const offset,
+      uint32_t const value)
+  {
+    char const* copy = "calexMisfitCubeTest.corrupt";
+    {
+      std::ifstream ifs(path, std::ios::binary);
+      std::ofstream ofs(copy, std::ios::binary);
+      ofs << ifs.rdbuf();
+    }
+    {
+      std::fstream fs(copy, std::ios::binary | std::ios::in | std::ios::out);
+      fs.seekp(offset);
+      fs.write(reinterpret_cast<char const*>(&value), sizeof(value));
+    }
+    bool rejected = false;
+    try { calex::MisfitCube::open(copy); }
+    catch (calex::Exception&) { rejected = true; }
+    remove(copy);
+    return rejected ? "rejected" : "ACCEPTED";
+  } // function corrupt
+
+} // namespace (unnamed)
+
+/* ------------------------------------------------------------------------- */
+int main(int iargc, char* argv[])
+{
+  char const* path = "calexMisfitCubeTest.cube";
+  calex::GridAxes::Taxes axes;
+  axes.push_back(calex::GridAxes::Axis("dmp", 0.5, 0.8, 0.1));
+  axes.push_back(calex::GridAxes::Axis("per", 100., 140., 10.));
+  axes.push_back(calex::GridAxes::Axis("per", 10., 15., 2.5));
+  calex::GridAxes grid(axes);
+  std::vector<double> expected(grid.size());
+  {
+    std::shared_ptr<calex::MisfitCube> cube(
+        calex::MisfitCube::create(path, grid));
+    for (size_t i = 0; i < grid.size(); ++i)
+    {
+      std::vector<double> coordinates(grid.coordinates(i));
+      calex::CalexResult::TsystemParameters params;
+      params.push_back(std::make_pair("per", coordinates[1]));
+      calex::CalexResult result(10, 0.005+i*1e-4, params);
+      // every seventh node failed
+      if (0 == i % 7) { result.set_exitStatus(256); }
+      cube->store(coordinates, result);
+      expected[i] = result.isComputed() ? result.get_rms() : -1.;
+    }
+    std::vector<double> outside(3, 0.);
+    std::cout << "outside: " << cube->store(outside, calex::CalexResult())
+      << std::endl;
+    cube->sync();
+  }
+
+  std::shared_ptr<calex::MisfitCube> cube(calex::MisfitCube::open(path));
+  calex::GridAxes const& read(cube->get_axes());
+  std::cout << "dimensions: " << read.get_dimensions() << ", values: "
+    << cube->size() << std::endl;
+  for (unsigned int i = 0; i < read.get_dimensions(); ++i)
+  {
+    std::cout << "  " << read[i].Mname << " " << read[i].Mstart << " "
+      << read[i].Mend << " " << read[i].Mdelta << " " << read[i].Msamples
+      << std::endl;
+  }
+  size_t matching = 0;
+  for (size_t i = 0; i < cube->size(); ++i)
+  {
+    double const value = cube->at(i);
+    if ((value != value && expected[i] < 0.) || value == expected[i])
+    {
+      ++matching;
+    }
+  }
+  std::cout << "values: " << matching << " of " << cube->size()
+    << " identical" << std::endl;
+
+  // per x dmp surface at the low-pass period of 12.5 s
+  std::vector<unsigned int> indexes(3, 0);
+  indexes[2] = 1;
+  std::vector<double> surface(cube->plane(1, 0, indexes));
+  std::cout << "per x dmp surface:" << std::endl;
+  for (size_t i = 0; i < read[1].Msamples; ++i)
+  {
+    std::cout << " ";
+    for (size_t j = 0; j < read[0].Msamples; ++j)
+    {
+      std::cout << " " << surface[i*read[0].Msamples+j];
+    }
+    std::cout << std::endl;
+  }
+
+  // slice of all nodes with a damping of 0.7
+  std::vector<unsigned int> leading(1, 2);
+  std::shared_ptr<calex::MisfitSlice> slice(cube->slice(leading));
+  size_t const offset = 2*read.get_stride(0);
+  matching = 0;
+  for (size_t i = 0; i < slice->size(); ++i)
+  {
+    if (((*slice)[i] != (*slice)[i] && expected[offset+i] < 0.) ||
+        (*slice)[i] == expected[offset+i])
+    {
+      ++matching;
+    }
+  }
+  std::cout << "slice: " << matching << " of " << slice->size()
+    << " identical" << std::endl;
+
+  // samples of the first axis (behind the 32 bytes of the header, the name
+  // and three doubles of the axis record) and number of dimensions
+  calex::Exception::dont_report_on_construct();
+  std::cout << "axis samples exceeding the data: " << corrupt(path, 88, 40)
+    << std::endl;
+  std::cout << "dimensions exceeding the records: "
+    << corrupt(path, 12, 1000000) << std::endl;
+  remove(path);
+  return 0;
+} // function main
+
+/* ----- END OF calexMisfitCubeTest.cc  ----- */
@@ -0,0 +1,277 @@
+/*! \file calexMock.cc
+ * \brief Stand-in for the calex program.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Stand-in for the calex program. Reads a calex parameter file as
+ *          written by calex::CalexConfig::write and writes a calex shaped
+ *          \c *.out file (and stdout) with iteration lines, the final system
+ *          parameters and the QUAD line. The RMS is deterministic and
+ *          computed from the parameter values by calex::mockRms. Throughput
+ *          of the launcher, the output parser and the scheduler thus can be
+ *          measured without the calex program.
+ *
+ *          The behaviour is controlled by environment variables:
+ *          - CALEX_MOCK_SLEEP: wall-clock seconds of a run (default: 0)
+ *          - CALEX_MOCK_BURN: CPU seconds of a run (default: 0)
+ *          - CALEX_MOCK_FAIL: fraction of runs failing (exit status 1)
+ *          - CALEX_MOCK_NOCONV: fraction of runs not converging
+ *          - CALEX_MOCK_HANG: fraction of runs hanging after the first
+ *            iterations
+ *          Runs affected are selected deterministically by their parameter
+ *          values.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026  V0.1  Daniel Armbruster
+ *
+ * ============================================================================
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include <ctime>
+#include <unistd.h>
+#include <calexxx/engine.h>
+
+namespace
+{
+  //! system parameter read from the calex parameter file
+  struct Parameter
+  {
+    std::string Mnam;
+    double Mval;
+    double Munc;
+  }; // struct Parameter
+
+  /* ----------------------------------------------------------------------- */
+  //! query a numerical environment variable
+  double environment(char const* name)
+  {
+    char const* value = getenv(name);
+    return value ? atof(value) : 0.;
+  } // function environment
+
+  /* ----------------------------------------------------------------------- */
+  //! deterministic number in [0,1) derived from the parameter values
+  double selector(std::vector<double> const& values)
+  {
+    unsigned long hash = 14695981039346656037UL;
+    for (auto cit(values.cbegin()); cit != values.cend(); ++cit)
+    {
+      long micro = static_cast<long>(*cit*1e6);
+      for (size_t i = 0; i < sizeof(micro); ++i)
+      {
+        hash ^= (micro >> (8*i)) & 0xff;
+        hash *= 1099511628211UL;
+      }
+    }
+    return (hash >> 11)*(1./9007199254740992.);
+  } // function selector
+
+  /* ----------------------------------------------------------------------- */
+  //! consume CPU time
+  void burn(double const seconds)
+  {
+    if (seconds <= 0.) { return; }
+    volatile double x = 0.;
+    std::clock_t const end = std::clock()+seconds*CLOCKS_PER_SEC;
+    while (std::clock() < end)
+    {
+      for (int i = 0; i < 10000; ++i) { x += 1e-9; }
+    }
+  } // function burn
+
+  /* ----------------------------------------------------------------------- */
+  //! wait for wall-clock time
+  void wait(double const seconds)
+  {
+    if (seconds > 0.) { usleep(static_cast<useconds_t>(seconds*1e6)); }
+  } // function wait
+
+  /* ----------------------------------------------------------------------- */
+  //! write to the *.out file and stdout
+  void emit(std::ostream& out, std::string const& text)
+  {
+    out << text;
+    out.flush();
+    std::cout << text;
+    std::cout.flush();
+  } // function emit
+
+  /* ----------------------------------------------------------------------- */
+  //! format an iteration line
+  std::string iterationLine(unsigned int const iter, double const rms,
+      std::vector<double> const& cols)
+  {
+    std::ostringstream oss;
+    oss << std::fixed << std::setw(5) << iter << std::setprecision(6)
+      << std::setw(12) << rms;
+    for (auto cit(cols.cbegin()); cit != cols.cend(); ++cit)
+    {
+      oss << std::setw(12) << *cit;
+    }
+    oss << "\n";
+    return oss.str();
+  } // function iterationLine
+
+} // namespace (unnamed)
+
+/* ------------------------------------------------------------------------- */
+int main(int iargc, char* argv[])
+{
+  if (iargc != 2 || 0 == strcmp(argv[1], "-h"))
+  {
+    std::cout << "Usage: calexMock PARFILE" << std::endl;
+    return 0 == strcmp(argv[iargc-1], "-h") ? 0 : 2;
+  }
+  std::string param_path(argv[1]);
+  std::ifstream ifs(param_path.c_str());
+  if (! ifs)
+  {
+    std::cerr << "calexMock: cannot open " << param_path << std::endl;
+    return 2;
+  }
+
+  // read parameter file
+  std::string comment;
+  getline(ifs, comment);
+  unsigned int maxit = 80;
+  std::vector<Parameter> params;
+  std::string line;
+  while (getline(ifs, line))
+  {
+    std::istringstream iss(line);
+    std::vector<std::string> tokens;
+    std::string token;
+    while (iss >> token) { tokens.push_back(token); }
+    if (1 == tokens.size() && "end" == tokens[0]) { break; }
+    if (2 == tokens.size() && "maxit" == tokens[1])
+    {
+      maxit = atoi(tokens[0].c_str());
+    } else
+    if (3 == tokens.size() && 3 == tokens[0].size() &&
+        isalpha(tokens[0][0]))
+    {
+      Parameter param;
+      param.Mnam = tokens[0];
+      param.Mval = atof(tokens[1].c_str());
+      param.Munc = atof(tokens[2].c_str());
+      params.push_back(param);
+    }
+  }
+
+  std::vector<double> values;
+  std::vector<std::string> names;
+  std::vector<double> start;
+  std::vector<double> unc;
+  for (auto cit(params.cbegin()); cit != params.cend(); ++cit)
+  {
+    values.push_back(cit->Mval);
+    // only active parameters are inverted
+    if (0. != cit->Munc)
+    {
+      names.push_back(cit->Mnam);
+      start.push_back(cit->Mval);
+      unc.push_back(cit->Munc);
+    }
+  }
+  double const rms = calex::mockRms(values);
+  double const select = selector(values);
+  double const fail = environment("CALEX_MOCK_FAIL");
+  double const noconv = environment("CALEX_MOCK_NOCONV");
+  double const hang = environment("CALEX_MOCK_HANG");
+  if (select < fail) { return 1; }
+  bool const converged = select >= fail+noconv;
+  bool const hangs = select >= fail+noconv && select < fail+noconv+hang;
+  unsigned int const iterations = converged ? (maxit < 10 ? maxit : 10) :
+    maxit;
+
+  // calex writes these files into its working directory
+  char const* files[] = {"ausf", "einf", "synt", "rest", "winplot.par"};
+  for (size_t i = 0; i < sizeof(files)/sizeof(files[0]); ++i)
+  {
+    std::ofstream touch(files[i]);
+  }
+
+  std::string stem(param_path.substr(0, param_path.rfind(".par")));
+  std::ofstream out((stem+".out").c_str());
+  std::ostringstream oss;
+  oss << comment << "\n\n control parameters for the iteration:\n"
+    << "    maxit\n" << std::setw(9) << maxit << "\n\n"
+    << " iter         RMS";
+  for (auto cit(names.cbegin()); cit != names.cend(); ++cit)
+  {
+    oss << std::setw(12) << *cit;
+  }
+  oss << "\n\n" << iterationLine(0, 3.*rms, start) << "               +-"
+    << std::fixed << std::setprecision(6);
+  for (auto cit(unc.cbegin()); cit != unc.cend(); ++cit)
+  {
+    oss << std::setw(12) << *cit;
+  }
+  oss << "\n\n\n";
+  emit(out, oss.str());
+
+  // iterations converge geometrically to the final RMS
+  double const sleep = environment("CALEX_MOCK_SLEEP");
+  double const cpu = environment("CALEX_MOCK_BURN");
+  std::vector<double> corrections(names.size(), 0.);
+  double misfit = 3.*rms;
+  for (unsigned int iter = 1; iter <= iterations; ++iter)
+  {
+    wait(sleep/iterations);
+    burn(cpu/iterations);
+    if (hangs && iter > 3) { for (;;) { pause(); } }
+    misfit = converged ? rms+(misfit-rms)*0.25 : misfit*0.999;
+    emit(out, iterationLine(iter, misfit, corrections));
+  }
+
+  oss.str("");
+  oss << "\n\n final system parameters:\n\n iter         RMS";
+  for (auto cit(names.cbegin()); cit != names.cend(); ++cit)
+  {
+    oss << std::setw(12) << *cit;
+  }
+  oss << "\n" << iterationLine(iterations, converged ? rms : misfit, start)
+    << "\n QUAD called " << std::setw(4) << 13*iterations-1 << " times: "
+    << (converged ? "converged" : "not converged") << "\n"
+    << " output signal for final model...\n"
+    << " writing file synt\n"
+    << " residual error...\n"
+    << " writing file rest\n\n"
+    << " a plot-parameter file winplot.par was generated\n";
+  emit(out, oss.str());
+  return 0;
+} // function main
+
+/* ----- END OF calexMock.cc  ----- */
@@ -33,19 +33,33 @@
  * REVISIONS and CHANGES 
  * 03/06/2012  V0.1   Daniel Armbruster
  * 14/03/2012  V0.1.1 corrected usage text
+ * 17/10/2026  V0.2   binary output (calex::ResultFileWriter) and output file
+ *                    opened once
+ * 17/10/2026  V0.3   parse files concurrently (calex::parseFiles)
+ * 17/10/2026  V0.4   ingest files from a spool directory (calex::SpoolWatcher)
+ * 17/10/2026  V0.4.1 malformed files do not stop ingesting a spool directory
+ * 17/10/2026  V0.4.2 files written without convergence are read again once
+ *                    they are closed
  * 
  * ============================================================================
  */
  
-#define CALEXOUTFILEPARSER_VERSION "V0.1"
+#define CALEXOUTFILEPARSER_VERSION "V0.4"
 #define CALEXOUTFILEPARSER_LICENSE "GPLv2+"
 
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <memory>
+#include <chrono>
+#include <csignal>
 #include <boost/program_options.hpp>
 #include <boost/filesystem.hpp>
 #include <calexxx/resultdata.h>
+#include <calexxx/resultparser.h>
+#include <calexxx/spoolwatcher.h>
 
 namespace po = boost::program_options;
 namespace fs = boost::filesystem;
@@ -54,6 +68,113 @@ using std::cout;
 using std::cerr;
 using std::endl;
 
+namespace
+{
+  //! buffer size of the output file
+  const size_t OUTPUT_BUFFER = 1 << 20;
+  //! number of files parsed concurrently before their results are written
+  const size_t PARSE_BLOCK = 8192;
+  //! milliseconds waited for files in the spool directory at once
+  const int WATCH_TIMEOUT = 1000;
+  //! name of the default state file within the spool directory
+  const char WATCH_STATE[] = "calexOutFileParser.state";
+  //! termination requested by SIGINT or SIGTERM
+  volatile sig_atomic_t stop_requested = 0;
+
+  /* ----------------------------------------------------------------------- */
+  //! write the result data of a calex output file
+  void writeResult(calex::CalexResult const& result, fs::path const& infile,
+      std::ostream& out, calex::ResultFileWriter* writer, bool const header)
+  {
+    if (writer)
+    {
+      writer->write(result, infile.filename().string());
+    }
+    else
+    {
+      out << infile.filename() << " ";
+      if (header)
+      { 
+        out << '\n';
+        result.writeHeaderInfo(out);
+      }
+      result.writeLine(out);
+    }
+  } // function writeResult
+
+  /* ----------------------------------------------------------------------- */
+  //! signal handler requesting termination
+  void requestStop(int) { stop_requested = 1; }
+
+  /* ----------------------------------------------------------------------- */
+  //! ingest files from a spool directory until SIGINT or SIGTERM is caught
+  void watch(calex::SpoolWatcher& watcher, std::ostream& out,
+      bool const header, bool const verbose)
+  {
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    // no SA_RESTART: waiting for files is interrupted by the signal
+    action.sa_handler = &requestStop;
+    sigaction(SIGINT, &action, 0);
+    sigaction(SIGTERM, &action, 0);
+
+    // malformed files are reported below
+    calex::Exception::dont_report_on_construct();
+    std::vector<std::string> names;
+    std::vector<std::string> ingested;
+    calex::CalexResult result;
+    watcher.scan(names);
+    // files found by scanning may still be written
+    bool closed = false;
+    while (! stop_requested)
+    {
+      ingested.clear();
+      calex::ResultParser& parser(calex::ResultParser::local());
+      for (auto cit(names.cbegin()); cit != names.cend(); ++cit)
+      {
+        try
+        {
+          // files still written are reported again once they are closed
+          if (! parser.parseFile(watcher.path(*cit)) || ! parser.found())
+          {
+            continue;
+          }
+          parser.get_result(result);
+          // a file still written may lack the QUAD line following the values
+          if (! closed &&
+              calex::UnknownConvergence == result.get_convergence())
+          {
+            continue;
+          }
+        }
+        catch (...)
+        {
+          cerr << "calexOutFileParser: Skipping malformed file '"
+            << watcher.path(*cit) << "'"
+            << (closed ? "." : " (read again once it is closed).") << endl;
+          // a malformed file closed is recorded as ingested and never read
+          // again
+          if (closed) { ingested.push_back(*cit); }
+          continue;
+        }
+        writeResult(result, fs::path(*cit), out, 0, header);
+        ingested.push_back(*cit);
+      }
+      // results must be written before the files are recorded as ingested
+      out.flush();
+      if (! out.good()) { throw std::string("Error while writing results."); }
+      watcher.commit(ingested);
+      if (verbose && ! ingested.empty())
+      {
+        cout << "calexOutFileParser: Ingested " << ingested.size()
+          << " file(s) (" << watcher.get_count() << " in total)." << endl;
+      }
+      closed = watcher.wait(names, WATCH_TIMEOUT);
+    }
+  } // function watch
+
+} // namespace (unnamed)
+
 int main(int iargc, char* argv[])
 {
   // define usage information
@@ -64,8 +185,12 @@ int main(int iargc, char* argv[])
     "    SVN: $Id$\n" 
     " Author: Daniel Armbruster" "\n"
     "  Usage: calexOutFileParser [-v|--verbose] [-o|--overwrite]" "\n"
-    "           [-H|--header] [-f|--file arg]" "\n"
+    "           [-H|--header] [-f|--file arg [-b|--binary]]" "\n"
+    "           [-j|--threads arg]" "\n"
     "           CALEXOUTFILE [CALEXOUTFILE [...]]" "\n"
+    "     or: calexOutFileParser [-v|--verbose] [-H|--header] [-f|--file arg]"
+    "\n"
+    "           [-s|--state arg] -w|--watch SPOOLDIR" "\n"
     "     or: calexOutFileParser -V|--version" "\n"
     "     or: calexOutFileParser -h|--help" "\n"
   };
@@ -85,6 +210,19 @@ int main(int iargc, char* argv[])
       ("header,H", "Additionally print a header line to each result.")
       ("file,f", po::value<fs::path>(),
       "Write result data to arg instead to stdout.")
+      ("binary,b", "Write result data in the binary format of "
+      "calex::ResultFileWriter (requires option '-f|--file').")
+      ("threads,j", po::value<unsigned int>(),
+      "Parse the files by arg threads concurrently (0: number of hardware "
+      "threads). The results are written in the order of the files.")
+      ("watch,w", po::value<fs::path>(),
+      "Ingest calex *.out files from the spool directory arg until SIGINT or "
+      "SIGTERM is caught. Each file is parsed once it is closed. Result data "
+      "is appended to arg in option '-f|--file'.")
+      ("state,s", po::value<fs::path>(),
+      "Record files ingested in the state file arg such that a restart does "
+      "not ingest them again (default: calexOutFileParser.state within the "
+      "spool directory).")
       ;
 
     // Hidden options, will be allowed both on command line and
@@ -92,7 +230,7 @@ int main(int iargc, char* argv[])
     po::options_description hidden_options("Hidden options");
     hidden_options.add_options()
       ("input-file",
-        po::value<std::vector<fs::path>>()->required(),
+        po::value<std::vector<fs::path>>(),
         "Filepath for calex *.out files.")
       ;
 
@@ -124,77 +262,159 @@ int main(int iargc, char* argv[])
       exit(0);
     }
     po::notify(vm);
+    if (vm.count("watch"))
+    {
+      if (vm.count("input-file"))
+      {
+        throw std::string("Option 'watch' does not accept input files.");
+      }
+      if (vm.count("binary") || vm.count("threads"))
+      {
+        throw std::string(
+          "Option 'watch' cannot be combined with 'binary' or 'threads'.");
+      }
+    } else
+    if (! vm.count("input-file"))
+    {
+      throw std::string("No input files specified.");
+    }
 
     // write result to a file instead to stdout?
+    // the file is opened once for all results
+    std::vector<char> buffer;
+    std::ofstream ofs;
+    std::ostream* out = &cout;
     if (vm.count("file"))
     {
       const fs::path& outpath = vm["file"].as<fs::path>();
+      // a spool directory is ingested across restarts into the same file
+      std::ios::openmode mode(std::ios::binary | std::ios::trunc);
+      if (vm.count("watch"))
+      {
+        mode = std::ios::binary | std::ios::app;
+      } else
       if (fs::exists(outpath) && ! vm.count("overwrite"))
       {
         throw std::string("File exists. Specify option 'overwrite'.");
       }
+      buffer.resize(OUTPUT_BUFFER);
+      ofs.rdbuf()->pubsetbuf(&buffer[0], buffer.size());
+#if BOOST_FILESYSTEM_VERSION == 2
+      ofs.open(outpath.string().c_str(), mode);
+#else
+      ofs.open(outpath.c_str(), mode);
+#endif
+      if (! ofs)
+      {
+        throw std::string("Cannot open '"+outpath.string()+"'.");
+      }
+      out = &ofs;
+    } else
+    if (vm.count("binary"))
+    {
+      throw std::string("Option 'binary' requires option 'file'.");
+    }
+    std::unique_ptr<calex::ResultFileWriter> writer;
+    if (vm.count("binary")) { writer.reset(new calex::ResultFileWriter(ofs)); }
+
+    const std::vector<fs::path> none;
+    const std::vector<fs::path>& infiles = vm.count("input-file") ?
+      vm["input-file"].as<std::vector<fs::path>>() : none;
+    auto start(std::chrono::steady_clock::now());
+    if (vm.count("watch"))
+    {
+      const fs::path& spool = vm["watch"].as<fs::path>();
+      const fs::path state(vm.count("state") ?
+        vm["state"].as<fs::path>() : spool / WATCH_STATE);
+      calex::SpoolWatcher watcher(spool.string(), state.string());
+      if (vm.count("verbose"))
+      {
+        cout << "calexOutFileParser: Watching spool directory: '"
+          << spool.string() << "' (" << watcher.get_count()
+          << " file(s) ingested previously) ..." << endl;
+      }
+      watch(watcher, *out, vm.count("header"), vm.count("verbose"));
+      if (vm.count("verbose"))
+      {
+        cout << "calexOutFileParser: Stopped watching spool directory ("
+          << watcher.get_count() << " file(s) ingested)." << endl;
+      }
     }
-    
-    // start loop over all calex result files
-    const std::vector<fs::path>& infiles = 
-      vm["input-file"].as<std::vector<fs::path>>();
-    for (auto cit(infiles.cbegin()); cit != infiles.cend(); ++cit)
+    else
+    if (vm.count("threads"))
     {
-      std::string filepath(cit->string());
-      // create instance of calex result data class
-      calex::CalexResult result;
-      if (fs::exists(*cit) && fs::is_regular_file(*cit))
+      // parse blocks of files concurrently
+      const unsigned int threads = vm["threads"].as<unsigned int>();
+      std::vector<std::string> paths;
+      std::vector<calex::CalexResult> results;
+      for (size_t begin = 0; begin < infiles.size(); begin += PARSE_BLOCK)
       {
-        if (vm.count("verbose"))
+        const size_t end = std::min(begin+PARSE_BLOCK, infiles.size());
+        paths.clear();
+        for (size_t i = begin; i < end; ++i)
         {
-          cout << "calexOutFileParser: Opening calex *.out file: '"
-            << filepath << "' ..." << endl;
+          paths.push_back(infiles[i].string());
         }
-        // read exemplary calex output file
-        std::ifstream ifs(filepath.c_str());
-        // set result data
-        ifs >> result;
-        // write result
-        if (vm.count("file"))
+        calex::parseFiles(paths, results, threads);
+        for (size_t i = begin; i < end; ++i)
         {
-          const fs::path& outpath = vm["file"].as<fs::path>();
-          if (infiles.cbegin() == cit)
+          if (calex::Failed == results[i-begin].get_status())
           {
-            fs::remove(outpath);
+            throw std::string(
+              "Error while reading result data of '"+paths[i-begin]+"'.");
           }
-#if BOOST_FILESYSTEM_VERSION == 2
-          std::ofstream ofs(outpath.string().c_str(), std::ios::app);
-#else
-          std::ofstream ofs(outpath.c_str(), std::ios::app);
-#endif
-          ofs << cit->filename() << " ";
-          if (vm.count("header")) 
-          { 
-            cout << endl;
-            result.writeHeaderInfo(ofs);
+          if (! results[i-begin].isComputed())
+          {
+            throw std::string(
+              "'"+paths[i-begin]+"' does not exist or is not readable.");
           }
-          result.writeLine(ofs);
+          writeResult(results[i-begin], infiles[i], *out, writer.get(),
+              vm.count("header"));
         }
-        else
+      }
+    }
+    else
+    {
+      // start loop over all calex result files
+      for (auto cit(infiles.cbegin()); cit != infiles.cend(); ++cit)
+      {
+        std::string filepath(cit->string());
+        // create instance of calex result data class
+        calex::CalexResult result;
+        if (fs::exists(*cit) && fs::is_regular_file(*cit))
         {
-          cout << cit->filename() << " ";
-          if (vm.count("header"))
-          { 
-            cout << endl;
-            result.writeHeaderInfo(cout);
+          if (vm.count("verbose"))
+          {
+            cout << "calexOutFileParser: Opening calex *.out file: '"
+              << filepath << "' ..." << endl;
           }
-          result.writeLine(cout);
+          // read exemplary calex output file
+          std::ifstream ifs(filepath.c_str());
+          // set result data
+          ifs >> result;
+          // write result
+          writeResult(result, *cit, *out, writer.get(), vm.count("header"));
+        }
+        else
+        {
+          throw std::string(
+            "'"+filepath+"' does not exist or is not a regular file.");
         }
       }
-      else
-      {
-        throw std::string(
-          "'"+filepath+"' does not exist or is not a regular file.");
-      }
     }
-    if (vm.count("verbose"))
+    if (writer) { writer->close(); }
+    if (ofs.is_open())
+    {
+      ofs.close();
+      if (ofs.fail()) { throw std::string("Error while writing output file."); }
+    }
+    if (vm.count("verbose") && ! vm.count("watch"))
     {
-      cout << "calexOutFileParser: Data successfully read." << endl;
+      std::chrono::duration<double> elapsed(
+          std::chrono::steady_clock::now()-start);
+      cout << "calexOutFileParser: Data successfully read ("
+        << infiles.size() << " files in " << elapsed.count() << " s, "
+        << infiles.size()/elapsed.count() << " files/s)." << endl;
     }
   }
   catch (const std::string e) 
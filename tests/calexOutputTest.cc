@@ -0,0 +1,154 @@
+/*! \file calexOutputTest.cc
+ * \brief Test of the complete model of calex output files.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Test of the complete model of calex output files. The start
+ *          parameters, the iteration history, the final result, the
+ *          convergence information and the poles and zeros of the
+ *          exemplary calex output files are printed.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <memory>
+#include <calexxx/resultdata.h>
+#include <calexxx/calexoutput.h>
+
+namespace
+{
+  //! print a convergence state
+  char const* convergence(calex::Econvergence const state)
+  {
+    switch (state)
+    {
+      case calex::Converged: return "converged";
+      case calex::NotConverged: return "not converged";
+      default: return "unknown";
+    }
+  } // function convergence
+
+  /* ----------------------------------------------------------------------- */
+  //! print the model of a calex output file
+  void print(calex::CalexOutput const& output)
+  {
+    auto const& start(output.get_startParameters());
+    std::cout << "  start parameters:";
+    for (auto cit(start.cbegin()); cit != start.cend(); ++cit)
+    {
+      std::cout << " " << cit->Mnam << "=" << cit->Mval << "+-" << cit->Munc;
+      if (! cit->Msubsystem.empty()) { std::cout << "(" << cit->Msubsystem
+        << ")"; }
+    }
+    std::cout << std::endl;
+    auto const& names(output.get_names());
+    auto const& iterations(output.get_iterations());
+    auto const& trajectory(output.get_trajectory());
+    std::cout << "  " << iterations.size() << " iterations of";
+    for (auto cit(names.cbegin()); cit != names.cend(); ++cit)
+    {
+      std::cout << " " << *cit;
+    }
+    std::cout << std::endl;
+    for (size_t i = 0; i < iterations.size(); ++i)
+    {
+      std::cout << "  " << iterations[i].Miter << " " << iterations[i].Mrms;
+      for (size_t j = 0; j < names.size(); ++j)
+      {
+        std::cout << " " << trajectory[i*names.size()+j];
+      }
+      std::cout << std::endl;
+    }
+    std::cout << "  uncertainties:";
+    auto const& unc(output.get_uncertainties());
+    for (auto cit(unc.cbegin()); cit != unc.cend(); ++cit)
+    {
+      std::cout << " " << *cit;
+    }
+    std::cout << std::endl;
+    calex::CalexResult const& result(output.get_result());
+    std::cout << "  result: iter=" << result.get_iter() << " rms="
+      << result.get_rms() << " QUAD=" << result.get_quadCalls() << " "
+      << convergence(result.get_convergence()) << std::endl;
+    std::cout << "  converged after " << output.convergedAfter()
+      << " iterations" << std::endl;
+    std::cout << "  " << output.get_zeros() << " zeros, real poles:";
+    auto const& real(output.get_realPoles());
+    for (auto cit(real.cbegin()); cit != real.cend(); ++cit)
+    {
+      std::cout << " " << *cit;
+    }
+    std::cout << ", complex poles:";
+    auto const& complex(output.get_complexPoles());
+    for (auto cit(complex.cbegin()); cit != complex.cend(); ++cit)
+    {
+      std::cout << " " << *cit;
+    }
+    std::cout << std::endl;
+  } // function print
+
+} // namespace (unnamed)
+
+/* ------------------------------------------------------------------------- */
+int main(int iargc, char* argv[])
+{
+  char const* files[] = {"calex.out", "calex.out.0"};
+  for (size_t i = 0; i < sizeof(files)/sizeof(files[0]); ++i)
+  {
+    std::shared_ptr<calex::CalexOutput> output(
+        calex::CalexOutput::readFile(files[i]));
+    if (! output)
+    {
+      std::cout << files[i] << ": not readable" << std::endl;
+      continue;
+    }
+    std::cout << files[i] << ":" << std::endl;
+    print(*output);
+
+    // the QUAD line is read by the input stream operator, too
+    calex::CalexResult expected;
+    std::ifstream ifs(files[i]);
+    ifs >> expected;
+    std::cout << "  input stream operator: QUAD=" << expected.get_quadCalls()
+      << " " << convergence(expected.get_convergence()) << std::endl;
+  }
+
+  // eager decoding of an output without iteration table and poles
+  calex::CalexOutput partial(
+      " final system parameters:\n iter RMS per\n 7 0.25 120.5\n"
+      " QUAD called   20 times: not converged\n", false);
+  std::cout << "partial output:" << std::endl;
+  print(partial);
+  return 0;
+} // function main
+
+/* ----- END OF calexOutputTest.cc  ----- */
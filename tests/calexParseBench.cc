@@ -0,0 +1,150 @@
+/*! \file calexParseBench.cc
+ * \brief Benchmark of parsing calex output files concurrently.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Benchmark of parsing calex output files concurrently. Copies of
+ *          the exemplary calex output file with differing RMS are written
+ *          into a scratch directory. They are read one after another by the
+ *          input stream operator of calex::CalexResult (as
+ *          calexOutFileParser does by default) and by calex::parseFiles with
+ *          an increasing number of threads. Files per second are reported.
+ *          Notice that the files are in the page cache; reading them from a
+ *          network file system scales further with the number of threads
+ *          since the threads mainly wait for I/O.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <boost/thread.hpp>
+#include <calexxx/resultdata.h>
+#include <calexxx/resultparser.h>
+#include <calexxx/scratchdir.h>
+
+namespace
+{
+  //! seconds elapsed since \a start
+  double seconds(std::chrono::steady_clock::time_point const& start)
+  {
+    std::chrono::duration<double> elapsed(
+        std::chrono::steady_clock::now()-start);
+    return elapsed.count();
+  } // function seconds
+
+} // namespace (unnamed)
+
+/* ------------------------------------------------------------------------- */
+int main(int iargc, char* argv[])
+{
+  if (iargc > 1 && 0 == strcmp(argv[1], "-h"))
+  {
+    std::cout << "Usage: calexParseBench [FILES [MAXTHREADS]]" << std::endl;
+    return 0;
+  }
+  size_t const files = iargc > 1 ? atol(argv[1]) : 20000;
+  unsigned int max_threads = iargc > 2 ? atoi(argv[2]) :
+    2*boost::thread::hardware_concurrency();
+  if (max_threads < 1) { max_threads = 1; }
+
+  // exemplary output with a placeholder for the RMS of the final block
+  std::ostringstream oss;
+  oss << std::ifstream("calex.out").rdbuf();
+  std::string const output(oss.str());
+  size_t const pos = output.rfind("0.005081");
+  if (output.empty() || std::string::npos == pos)
+  {
+    std::cerr << "calexParseBench: run within the tests directory"
+      << std::endl;
+    return 1;
+  }
+
+  calex::ScratchDirectory scratch(".", "calexParseBench");
+  std::vector<std::string> paths;
+  auto start(std::chrono::steady_clock::now());
+  for (size_t i = 0; i < files; ++i)
+  {
+    std::ostringstream path;
+    path << scratch.get_path() << "/calex" << i << ".out";
+    paths.push_back(path.str());
+    std::ostringstream rms;
+    rms << std::fixed << std::setprecision(6) << 1e-6*(i % 999983);
+    std::ofstream ofs(paths.back().c_str());
+    ofs << output.substr(0, pos) << rms.str()
+      << output.substr(pos+rms.str().size());
+  }
+  std::cout << "files: " << files << " (" << output.size()
+    << " bytes each, written in " << std::fixed << std::setprecision(2)
+    << seconds(start) << " s)" << std::endl;
+  std::cout << std::setw(24) << "reader" << std::setw(10) << "threads"
+    << std::setw(14) << "files/s" << std::setw(10) << "speedup" << std::endl;
+
+  // input stream operator one file after another
+  std::vector<calex::CalexResult> expected(files);
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < files; ++i)
+  {
+    std::ifstream ifs(paths[i].c_str());
+    ifs >> expected[i];
+  }
+  double const baseline = files/seconds(start);
+  std::cout << std::setw(24) << "operator>>" << std::setw(10) << 1
+    << std::setprecision(0) << std::setw(14) << baseline
+    << std::setprecision(2) << std::setw(10) << 1. << std::endl;
+
+  std::vector<calex::CalexResult> results;
+  for (unsigned int threads = 1; threads <= max_threads; threads *= 2)
+  {
+    start = std::chrono::steady_clock::now();
+    calex::parseFiles(paths, results, threads);
+    double const rate = files/seconds(start);
+    size_t different = 0;
+    for (size_t i = 0; i < files; ++i)
+    {
+      if (results[i].get_rms() != expected[i].get_rms() ||
+          results[i].get_size() != expected[i].get_size()) { ++different; }
+    }
+    std::cout << std::setw(24) << "calex::parseFiles" << std::setw(10)
+      << threads << std::setprecision(0) << std::setw(14) << rate
+      << std::setprecision(2) << std::setw(10) << rate/baseline;
+    if (different) { std::cout << "  (" << different << " DIFFERENT)"; }
+    std::cout << std::endl;
+  }
+  return 0;
+} // function main
+
+/* ----- END OF calexParseBench.cc  ----- */
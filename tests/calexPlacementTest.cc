@@ -0,0 +1,97 @@
+/*! \file calexPlacementTest.cc
+ * \brief Testing CPU and NUMA placement of calex processes.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Testing CPU and NUMA placement of calex processes. Since the calex
+ * program itself may not be available standard system utilities are
+ * launched instead.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <memory>
+#include <sched.h>
+#include <calexxx/placement.h>
+#include <calexxx/launcher.h>
+#include <calexxx/forkserver.h>
+#include <calexxx/limiter.h>
+
+//! spawn a process placed according to the policy and check its affinity
+void place(calex::CalexLauncher const& launcher, calex::CpuPlacement& placement,
+    char const* name)
+{
+  std::cout << name << ": " << placement.get_order().size() << " CPUs";
+  for (int i = 0; i < 3; ++i)
+  {
+    calex::SpawnOptions options;
+    placement.assign(options);
+    pid_t pid = launcher.spawn("0.2", options);
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    sched_getaffinity(pid, sizeof(set), &set);
+    std::cout << "  pinned=" << (1 == CPU_COUNT(&set) &&
+        CPU_ISSET(options.Mcpu, &set));
+    placement.log(pid, options, 0.2);
+    launcher.wait(pid);
+  }
+  std::cout << std::endl;
+}
+
+int main(int iargc, char* argv[])
+{
+  unsigned int cores = calex::availableCores();
+  calex::CalexLauncher launcher("sleep");
+
+  calex::CpuPlacement round_robin(calex::RoundRobin);
+  calex::CpuPlacement compact(calex::Compact);
+  calex::CpuPlacement spread(calex::Spread, true);
+  place(launcher, round_robin, "round-robin");
+  place(launcher, compact, "compact");
+  place(launcher, spread, "spread (local memory)");
+  std::cout << "orders complete: "
+    << (cores == round_robin.get_order().size() &&
+        cores == compact.get_order().size() &&
+        cores == spread.get_order().size()) << std::endl;
+
+  // the spawning thread's affinity is restored
+  std::cout << "caller affinity restored: "
+    << (cores == calex::availableCores()) << std::endl;
+
+  // placement is forwarded to processes spawned by the fork server
+  std::shared_ptr<calex::CalexForkServer> server(new calex::CalexForkServer);
+  server->start();
+  launcher.set_forkServer(server);
+  place(launcher, round_robin, "round-robin (fork server)");
+
+  return 0;
+} // function main
+
+/* ----- END OF calexPlacementTest.cc  ----- */
@@ -0,0 +1,88 @@
+/*! \file calexPruningTest.cc
+ * \brief Testing early termination of hopeless calex runs.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Testing early termination of hopeless calex runs. The calex
+ * output of calex.out is fed to the iteration monitor in small chunks as if
+ * it was read from a pipe.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <calexxx/pruning.h>
+
+//! feed calex output in chunks and report the monitor's decision
+void monitor(std::string const& output, calex::PruningPolicy const& policy,
+    calex::BestRms const& best)
+{
+  calex::IterationMonitor monitor(policy, best);
+  std::string received;
+  for (size_t pos = 0; pos < output.size() && ! monitor.prune(); pos += 37)
+  {
+    received.append(output, pos, 37);
+    monitor.feed(received);
+  }
+  std::cout << "best=" << best.get() << " ratio=" << policy.Mratio
+    << " min_iter=" << policy.MminIter << ": pruned=" << monitor.prune()
+    << " iter=" << monitor.get_iter() << " rms=" << monitor.get_rms()
+    << std::endl;
+}
+
+int main(int iargc, char* argv[])
+{
+  std::ifstream ifs("calex.out");
+  std::ostringstream oss;
+  oss << ifs.rdbuf();
+  std::string const output(oss.str());
+
+  calex::BestRms best;
+  // nothing to compare with yet
+  monitor(output, calex::PruningPolicy(2., 3), best);
+
+  // the best RMS only decreases
+  std::cout << "offer 0.004: " << best.offer(0.004) << std::endl;
+  std::cout << "offer 0.006: " << best.offer(0.006) << std::endl;
+  std::cout << "offer 0.002: " << best.offer(0.002) << std::endl;
+
+  // hopeless run: pruned after the third iteration
+  monitor(output, calex::PruningPolicy(2., 3), best);
+  // competitive run
+  monitor(output, calex::PruningPolicy(3., 3), best);
+  // pruning disabled
+  monitor(output, calex::PruningPolicy(), best);
+
+  return 0;
+} // function main
+
+/* ----- END OF calexPruningTest.cc  ----- */
@@ -0,0 +1,254 @@
+/*! \file calexResultBench.cc
+ * \brief Benchmark of parsing calex output files.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Benchmark of parsing calex output files. A number of calex
+ *          output files is derived from the exemplary file calex.out.
+ *          Files per second are measured for the input stream operator of
+ *          calex::CalexResult and for calex::ResultParser, with and without
+ *          converting into calex::CalexResult. Heap allocations are counted
+ *          by replacing the global operator new. Finally the memory of
+ *          result data stored per node of a grid is compared to the layout
+ *          storing a name string per system parameter.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 17/10/2026  V0.2  measure patching the precompiled template
+ * 17/10/2026  V0.3  measure bytes of result data per node
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <utility>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <atomic>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <calexxx/resultdata.h>
+#include <calexxx/resultparser.h>
+
+namespace
+{
+  //! number of heap allocations
+  std::atomic<unsigned long> allocations(0);
+  //! number of bytes allocated
+  std::atomic<unsigned long> allocated_bytes(0);
+
+} // namespace (unnamed)
+
+/* ------------------------------------------------------------------------- */
+void* operator new(size_t size)
+{
+  ++allocations;
+  allocated_bytes += size;
+  void* ptr = malloc(size ? size : 1);
+  if (! ptr) { throw std::bad_alloc(); }
+  return ptr;
+}
+
+/* ------------------------------------------------------------------------- */
+void operator delete(void* ptr) throw()
+{
+  free(ptr);
+}
+
+namespace
+{
+  //! parse methods
+  enum Emethod { STREAM, PARSER, FIELDS };
+
+  /* ----------------------------------------------------------------------- */
+  //! parse all files and return the sum of the RMS values
+  double parse(Emethod method, std::vector<std::string> const& paths,
+      double& seconds, unsigned long& allocated)
+  {
+    double sum = 0.;
+    calex::ResultParser& parser(calex::ResultParser::local());
+    // warm up the parser's buffers
+    parser.parseFile(paths[0]);
+    unsigned long const before = allocations;
+    auto start(std::chrono::steady_clock::now());
+    for (auto cit(paths.cbegin()); cit != paths.cend(); ++cit)
+    {
+      if (STREAM == method)
+      {
+        calex::CalexResult result;
+        std::ifstream ifs(cit->c_str());
+        ifs >> result;
+        sum += result.get_rms();
+      } else
+      if (PARSER == method)
+      {
+        calex::CalexResult result;
+        if (parser.parseFile(*cit)) { parser.get_result(result); }
+        sum += result.get_rms();
+      }
+      else
+      {
+        if (parser.parseFile(*cit)) { sum += parser.get_rms(); }
+      }
+    }
+    std::chrono::duration<double> elapsed(
+        std::chrono::steady_clock::now()-start);
+    seconds = elapsed.count();
+    allocated = allocations-before;
+    return sum;
+  } // function parse
+
+  /* ----------------------------------------------------------------------- */
+  //! layout of result data storing a name string per system parameter
+  struct NamedResult
+  {
+    int Mstatus;
+    int MexitStatus;
+    unsigned int Miter;
+    double Mrms;
+    std::vector<std::pair<std::string, double>> MsystemParameters;
+    unsigned int MquadCalls;
+    int Mconvergence;
+  }; // struct NamedResult
+
+  /* ----------------------------------------------------------------------- */
+  //! bytes per node of result data stored for all files
+  template <typename Rtype>
+  double bytesPerNode(std::vector<std::string> const& paths,
+      void (*convert)(calex::ResultParser const&, Rtype&))
+  {
+    calex::ResultParser& parser(calex::ResultParser::local());
+    std::vector<Rtype> nodes(paths.size());
+    unsigned long const before = allocated_bytes;
+    for (size_t i = 0; i < paths.size(); ++i)
+    {
+      if (parser.parseFile(paths[i])) { convert(parser, nodes[i]); }
+    }
+    return sizeof(Rtype)+
+      static_cast<double>(allocated_bytes-before)/paths.size();
+  } // function bytesPerNode
+
+  /* ----------------------------------------------------------------------- */
+  //! convert into the layout storing name strings
+  void convertNamed(calex::ResultParser const& parser, NamedResult& result)
+  {
+    result.Miter = parser.get_iter();
+    result.Mrms = parser.get_rms();
+    for (size_t i = 2; i < parser.get_size(); ++i)
+    {
+      result.MsystemParameters.push_back(std::make_pair(
+            std::string(parser.get_names()[i].first,
+              parser.get_names()[i].second), parser.get_values()[i]));
+    }
+  } // function convertNamed
+
+  /* ----------------------------------------------------------------------- */
+  //! convert into calex::CalexResult
+  void convertResult(calex::ResultParser const& parser,
+      calex::CalexResult& result)
+  {
+    parser.get_result(result);
+  } // function convertResult
+
+} // namespace (unnamed)
+
+/* ------------------------------------------------------------------------- */
+int main(int iargc, char* argv[])
+{
+  if (iargc > 1 && 0 == strcmp(argv[1], "-h"))
+  {
+    std::cout << "Usage: calexResultBench [FILES [DIRECTORY]]" << std::endl;
+    return 0;
+  }
+  int const files = iargc > 1 ? atoi(argv[1]) : 100000;
+  std::string const dir(iargc > 2 ? argv[2] : "calexResultBench.d");
+
+  // derive calex output files with distinct RMS values
+  std::ifstream ifs("calex.out");
+  std::ostringstream oss;
+  oss << ifs.rdbuf();
+  std::string const output(oss.str());
+  size_t const pos = output.find("0.005081", output.find("final system"));
+  if (output.empty() || std::string::npos == pos)
+  {
+    std::cerr << "calexResultBench: calex.out not found" << std::endl;
+    return 2;
+  }
+  mkdir(dir.c_str(), 0700);
+  std::vector<std::string> paths;
+  paths.reserve(files);
+  for (int i = 0; i < files; ++i)
+  {
+    std::ostringstream path;
+    path << dir << "/calex-" << i << ".out";
+    paths.push_back(path.str());
+    std::ostringstream rms;
+    rms << std::fixed << std::setprecision(6) << 0.005+1e-6*(i % 1000);
+    std::ofstream ofs(paths.back().c_str());
+    ofs << output.substr(0, pos) << rms.str() << output.substr(pos+8);
+  }
+
+  char const* labels[] = {"operator>>", "ResultParser",
+    "ResultParser fields"};
+  std::cout << "files: " << files << "\n" << std::setw(20) << "method"
+    << std::setw(14) << "files/s" << std::setw(14) << "allocs/file"
+    << std::setw(14) << "RMS sum" << std::endl;
+  for (int method = STREAM; method <= FIELDS; ++method)
+  {
+    double seconds;
+    unsigned long allocated;
+    double const sum = parse(static_cast<Emethod>(method), paths, seconds,
+        allocated);
+    std::cout << std::setw(20) << labels[method] << std::fixed
+      << std::setprecision(1) << std::setw(14) << files/seconds
+      << std::setprecision(2) << std::setw(14)
+      << static_cast<double>(allocated)/files << std::setprecision(6)
+      << std::setw(14) << sum << std::endl;
+  }
+
+  // node storage excludes the vector of nodes itself
+  std::cout << std::setw(20) << "layout" << std::setw(14) << "bytes/node"
+    << "\n" << std::setw(20) << "name strings" << std::setprecision(1)
+    << std::setw(14) << bytesPerNode(paths, convertNamed) << "\n"
+    << std::setw(20) << "CalexResult" << std::setw(14)
+    << bytesPerNode(paths, convertResult) << std::endl;
+
+  for (auto cit(paths.cbegin()); cit != paths.cend(); ++cit)
+  {
+    unlink(cit->c_str());
+  }
+  rmdir(dir.c_str());
+  return 0;
+} // function main
+
+/* ----- END OF calexResultBench.cc  ----- */
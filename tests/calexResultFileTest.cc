@@ -0,0 +1,163 @@
+/*! \file calexResultFileTest.cc
+ * \brief Test of binary result files.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Test of binary result files. The result data of the exemplary
+ *          calex output files is written by calex::ResultFileWriter, read
+ *          back by calex::ResultFileReader and compared to the original
+ *          result data.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <calexxx/resultdata.h>
+
+namespace
+{
+  //! result data written to a string
+  std::string format(calex::CalexResult const& result)
+  {
+    std::ostringstream oss;
+    oss.precision(17);
+    oss << result.get_status() << " " << result.get_iter() << " "
+      << result.get_rms() << " " << result.get_quadCalls() << " "
+      << result.get_convergence();
+    auto const& params(result.get_systemParameters());
+    for (auto cit(params.cbegin()); cit != params.cend(); ++cit)
+    {
+      oss << " " << cit->first << "=" << cit->second;
+    }
+    return oss.str();
+  } // function format
+
+  /* ----------------------------------------------------------------------- */
+  //! compare result data read to the original (values missing must be NaN)
+  bool matches(calex::CalexResult const& original,
+      calex::CalexResult const& result)
+  {
+    if (original.get_status() != result.get_status() ||
+        original.get_iter() != result.get_iter() ||
+        original.get_rms() != result.get_rms() ||
+        original.get_quadCalls() != result.get_quadCalls() ||
+        original.get_convergence() != result.get_convergence())
+    {
+      return false;
+    }
+    auto const& expected(original.get_systemParameters());
+    auto const& params(result.get_systemParameters());
+    for (auto cit(params.cbegin()); cit != params.cend(); ++cit)
+    {
+      bool found = false;
+      for (auto eit(expected.cbegin()); eit != expected.cend(); ++eit)
+      {
+        if (eit->first != cit->first) { continue; }
+        if (eit->second != cit->second) { return false; }
+        found = true;
+      }
+      if (! found && cit->second == cit->second) { return false; }
+    }
+    return true;
+  } // function matches
+
+} // namespace (unnamed)
+
+/* ------------------------------------------------------------------------- */
+int main(int iargc, char* argv[])
+{
+  char const* files[] = {"calex.out", "calex.out.0", "calex.out"};
+  std::vector<calex::CalexResult> expected;
+  for (size_t i = 0; i < sizeof(files)/sizeof(files[0]); ++i)
+  {
+    calex::CalexResult result;
+    std::ifstream ifs(files[i]);
+    ifs >> result;
+    expected.push_back(result);
+  }
+  // a result not computed
+  expected.push_back(calex::CalexResult());
+
+  {
+    std::ofstream ofs("calexResultFileTest.bin", std::ios::binary);
+    calex::ResultFileWriter writer(ofs);
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+      writer.write(expected[i], i < 3 ? files[i] : "none");
+    }
+    writer.close();
+    std::cout << "records written: " << writer.get_count() << std::endl;
+  }
+
+  calex::ResultFileReader reader("calexResultFileTest.bin");
+  std::cout << "records read: " << reader.size() << std::endl;
+  std::cout << "schema:";
+  for (size_t j = 0; j < reader.get_schema()->size(); ++j)
+  {
+    std::cout << " " << (*reader.get_schema())[j];
+  }
+  std::cout << std::endl;
+  calex::CalexResult result;
+  for (size_t i = 0; i < reader.size(); ++i)
+  {
+    reader.read(i, result);
+    std::cout << reader.get_source(i) << ": "
+      << (matches(expected[i], result) ? "identical" : "DIFFERENT")
+      << " (" << format(result) << ")" << std::endl;
+  }
+  std::vector<double> column(reader.column(0));
+  std::cout << "column " << (*reader.get_schema())[0] << ":";
+  for (auto cit(column.cbegin()); cit != column.cend(); ++cit)
+  {
+    std::cout << " " << *cit;
+  }
+  std::cout << std::endl;
+
+  // records of a file not closed are still available
+  {
+    std::ofstream ofs("calexResultFileTest.bin", std::ios::binary);
+    calex::ResultFileWriter writer(ofs);
+    writer.write(expected[0], files[0]);
+    writer.write(expected[1], files[1]);
+    ofs.flush();
+    calex::ResultFileReader partial("calexResultFileTest.bin");
+    std::cout << "records of unclosed file: " << partial.size()
+      << ", sources " << (partial.hasSources() ? "available" : "missing")
+      << ", RMS " << partial.get_rms(1) << std::endl;
+  }
+  remove("calexResultFileTest.bin");
+  return 0;
+} // function main
+
+/* ----- END OF calexResultFileTest.cc  ----- */
@@ -0,0 +1,169 @@
+/*! \file calexResultParserTest.cc
+ * \brief Test of the fast calex output file parser.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Test of the fast calex output file parser. The result data
+ *          parsed by calex::ResultParser from the exemplary calex output
+ *          files is compared to the result data read by the input stream
+ *          operator of calex::CalexResult.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 17/10/2026  V0.2  malformed file parsed concurrently by calex::parseFiles
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <calexxx/resultdata.h>
+#include <calexxx/resultparser.h>
+#include <calexxx/scratchdir.h>
+
+namespace
+{
+  //! result data written to a string
+  std::string format(calex::CalexResult const& result)
+  {
+    std::ostringstream oss;
+    oss.precision(17);
+    oss << result.get_iter() << " " << result.get_rms();
+    auto const& params(result.get_systemParameters());
+    for (auto cit(params.cbegin()); cit != params.cend(); ++cit)
+    {
+      oss << " " << cit->first << "=" << cit->second;
+    }
+    return oss.str();
+  } // function format
+
+  /* ----------------------------------------------------------------------- */
+  //! compare the parser to the input stream operator
+  void compare(std::string const& label, std::string const& output)
+  {
+    calex::CalexResult expected;
+    std::istringstream iss(output);
+    iss >> expected;
+    calex::ResultParser& parser(calex::ResultParser::local());
+    parser.parse(output.data(), output.size());
+    calex::CalexResult result;
+    parser.get_result(result);
+    std::cout << label << ": "
+      << (format(expected) == format(result) ? "identical" : "DIFFERENT")
+      << " (" << format(result) << ")" << std::endl;
+  } // function compare
+
+} // namespace (unnamed)
+
+/* ------------------------------------------------------------------------- */
+int main(int iargc, char* argv[])
+{
+  char const* files[] = {"calex.out", "calex.out.0"};
+  for (size_t i = 0; i < sizeof(files)/sizeof(files[0]); ++i)
+  {
+    calex::CalexResult expected;
+    std::ifstream ifs(files[i]);
+    ifs >> expected;
+    calex::ResultParser& parser(calex::ResultParser::local());
+    calex::CalexResult result;
+    if (parser.parseFile(files[i])) { parser.get_result(result); }
+    std::cout << files[i] << ": "
+      << (format(expected) == format(result) ? "identical" : "DIFFERENT")
+      << std::endl;
+    result.writeHeaderInfo(std::cout);
+    result.writeLine(std::cout);
+
+    // in memory with the block preceded by a long iteration table
+    std::ostringstream oss;
+    oss << std::ifstream(files[i]).rdbuf();
+    std::string output(oss.str());
+    compare(std::string(files[i])+" in memory", output);
+    // block far from the end of the file
+    std::string trailer;
+    for (int j = 0; j < 200; ++j)
+    {
+      trailer += " writing file synt\n residual error...\n";
+    }
+    std::ofstream ofs("calexResultParserTest.out");
+    ofs << output << trailer;
+    ofs.close();
+    calex::CalexResult trailing;
+    if (parser.parseFile("calexResultParserTest.out"))
+    {
+      parser.get_result(trailing);
+    }
+    remove("calexResultParserTest.out");
+    std::cout << files[i] << " with long trailer: "
+      << (format(expected) == format(trailing) ? "identical" : "DIFFERENT")
+      << std::endl;
+  }
+
+  // further layouts of the block
+  compare("without colon",
+      " final system parameters\n iter RMS xyz\n 3 0.25 1e-3\n");
+  compare("windows line endings",
+      " final system parameters:\r\n\r\n iter RMS per\r\n"
+      " 7 0.123456789012345678 -0.0\r\n");
+  compare("without block", " iter RMS\n 0 1.0\n");
+
+  // a truncated file among files parsed by several threads
+  std::ostringstream oss;
+  oss << std::ifstream("calex.out").rdbuf();
+  std::string const output(oss.str());
+  std::string const truncated(output.substr(0, output.rfind("-40.969074")+5));
+  calex::ScratchDirectory scratch(".", "calexResultParserTest");
+  std::vector<std::string> paths;
+  for (int i = 0; i < 200; ++i)
+  {
+    std::ostringstream path;
+    path << scratch.get_path() << "/calex" << i << ".out";
+    paths.push_back(path.str());
+    std::ofstream ofs(paths.back().c_str());
+    ofs << (130 == i ? truncated : output);
+  }
+  paths.push_back(scratch.get_path()+"/missing.out");
+  calex::Exception::dont_report_on_construct();
+  std::vector<calex::CalexResult> results;
+  calex::parseFiles(paths, results, 4);
+  size_t computed = 0;
+  for (size_t i = 0; i < results.size(); ++i)
+  {
+    if (results[i].isComputed()) { ++computed; }
+  }
+  std::cout << "parsed concurrently: " << computed << " of " << paths.size()
+    << " computed, truncated file "
+    << (calex::Failed == results[130].get_status() ? "failed" : "NOT FAILED")
+    << ", missing file "
+    << (calex::NotComputed == results[200].get_status() ? "not computed" :
+        "COMPUTED") << std::endl;
+  return 0;
+} // function main
+
+/* ----- END OF calexResultParserTest.cc  ----- */
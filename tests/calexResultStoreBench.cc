@@ -0,0 +1,171 @@
+/*! \file calexResultStoreBench.cc
+ * \brief Benchmark of queries of the columnar result store.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Benchmark of queries of the columnar result store. Synthetic
+ *          results of a three-dimensional grid are stored within separately
+ *          allocated nodes (as liboptimizexx does) and within a
+ *          calex::ResultStore. The time of finding the best fit by
+ *          traversing the nodes is compared to the queries of the store.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <utility>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <chrono>
+#include <calexxx/resultdata.h>
+#include <calexxx/resultstore.h>
+
+namespace
+{
+  //! node of a grid as allocated by liboptimizexx
+  struct Node
+  {
+    std::vector<double> Mcoordinates;
+    calex::CalexResult Mresult;
+  }; // struct Node
+
+  //! point in time
+  typedef std::chrono::steady_clock::time_point Ttime;
+
+  /* ----------------------------------------------------------------------- */
+  //! milliseconds elapsed since \a start
+  double elapsed(Ttime const& start)
+  {
+    std::chrono::duration<double, std::milli> ms(
+        std::chrono::steady_clock::now()-start);
+    return ms.count();
+  } // function elapsed
+
+} // namespace (unnamed)
+
+/* ------------------------------------------------------------------------- */
+int main(int iargc, char* argv[])
+{
+  if (iargc > 1 && 0 == strcmp(argv[1], "-h"))
+  {
+    std::cout << "Usage: calexResultStoreBench [SAMPLES]" << std::endl;
+    return 0;
+  }
+  // samples per dimension of a cubic grid
+  unsigned int const samples = iargc > 1 ? atoi(argv[1]) : 216;
+  calex::ResultStore::Taxes axes(3, calex::ResultStore::Axis("per", 1.,
+        samples, 1.));
+  calex::ResultStore store(axes);
+
+  std::vector<Node*> nodes;
+  nodes.reserve(store.size());
+  std::vector<std::string> names;
+  names.push_back("amp");
+  names.push_back("del");
+  names.push_back("per");
+  names.push_back("dmp");
+  calex::ResultSchema const* schema(calex::ResultSchema::intern(names));
+  Ttime start(std::chrono::steady_clock::now());
+  for (size_t i = 0; i < store.size(); ++i)
+  {
+    Node* node = new Node;
+    node->Mcoordinates = store.coordinates(i);
+    double values[] = {-41.5, 0.01, node->Mcoordinates[1],
+      node->Mcoordinates[2]};
+    // pseudo-random RMS values
+    double const rms = 0.005+((i*2654435761UL) % 1000003)*1e-9;
+    node->Mresult = calex::CalexResult(10, rms, schema, values);
+    nodes.push_back(node);
+  }
+  double const build = elapsed(start);
+  start = std::chrono::steady_clock::now();
+  for (auto cit(nodes.cbegin()); cit != nodes.cend(); ++cit)
+  {
+    store.store(store.index((*cit)->Mcoordinates), (*cit)->Mresult);
+  }
+  double const fill = elapsed(start);
+
+  // traversal of all nodes
+  start = std::chrono::steady_clock::now();
+  Node const* best = 0;
+  for (auto cit(nodes.cbegin()); cit != nodes.cend(); ++cit)
+  {
+    if ((*cit)->Mresult.isComputed() && (! best ||
+          (*cit)->Mresult.get_rms() < best->Mresult.get_rms()))
+    {
+      best = *cit;
+    }
+  }
+  double const traversal = elapsed(start);
+
+  start = std::chrono::steady_clock::now();
+  size_t const argmin = store.argmin();
+  double const argmin_ms = elapsed(start);
+  start = std::chrono::steady_clock::now();
+  std::vector<size_t> top(store.topk(100));
+  double const topk_ms = elapsed(start);
+  start = std::chrono::steady_clock::now();
+  std::vector<size_t> filtered(store.filter(0.005+1e-5));
+  double const filter_ms = elapsed(start);
+  start = std::chrono::steady_clock::now();
+  double marginal = 0.;
+  for (unsigned int d = 0; d < store.get_dimensions(); ++d)
+  {
+    marginal += store.marginalMinima(d)[0];
+  }
+  double const marginal_ms = elapsed(start);
+
+  std::cout << "nodes: " << store.size() << " (building nodes "
+    << std::fixed << std::setprecision(1) << build << " ms, filling store "
+    << fill << " ms)\n"
+    << std::setw(24) << "query" << std::setw(12) << "ms" << "\n"
+    << std::setw(24) << "traversal argmin" << std::setw(12) << traversal
+    << "\n" << std::setw(24) << "store argmin" << std::setw(12) << argmin_ms
+    << "\n" << std::setw(24) << "store top 100" << std::setw(12) << topk_ms
+    << "\n" << std::setw(24) << "store filter" << std::setw(12) << filter_ms
+    << "\n" << std::setw(24) << "store marginal minima" << std::setw(12)
+    << marginal_ms << std::endl;
+  std::cout << "argmin "
+    << (best && store.index(best->Mcoordinates) == argmin ?
+        "identical" : "DIFFERENT") << ", best of top 100 "
+    << (! top.empty() && top[0] == argmin ? "identical" : "DIFFERENT")
+    << ", " << filtered.size() << " nodes filtered" << std::endl;
+
+  for (auto cit(nodes.cbegin()); cit != nodes.cend(); ++cit)
+  {
+    delete *cit;
+  }
+  return 0;
+} // function main
+
+/* ----- END OF calexResultStoreBench.cc  ----- */
@@ -0,0 +1,165 @@
+/*! \file calexResultStoreTest.cc
+ * \brief Test of the columnar store of result data.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Test of the columnar store of result data. Synthetic results of
+ *          a three-dimensional parameter space are stored and the queries
+ *          of calex::ResultStore are compared to a traversal of all
+ *          results.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <vector>
+#include <string>
+#include <utility>
+#include <cmath>
+#include <calexxx/resultdata.h>
+#include <calexxx/resultstore.h>
+
+namespace
+{
+  //! print coordinate indexes
+  void print(std::string const& label, std::vector<size_t> const& indexes)
+  {
+    std::cout << label << ":";
+    for (auto cit(indexes.cbegin()); cit != indexes.cend(); ++cit)
+    {
+      std::cout << " " << *cit;
+    }
+    std::cout << std::endl;
+  } // function print
+
+} // namespace (unnamed)
+
+/* ------------------------------------------------------------------------- */
+int main(int iargc, char* argv[])
+{
+  // damping x period x low-pass period
+  double const axes[][3] = {{0.5, 0.1, 4}, {100., 10., 5}, {10., 2.5, 3}};
+  char const* names[] = {"dmp", "per", "per"};
+  calex::ResultStore::Taxes store_axes;
+  for (size_t i = 0; i < 3; ++i)
+  {
+    store_axes.push_back(calex::ResultStore::Axis(names[i], axes[i][0],
+          axes[i][0]+(axes[i][2]-1)*axes[i][1], axes[i][1]));
+  }
+  calex::ResultStore store(store_axes);
+  std::cout << "nodes: " << store.size() << std::endl;
+
+  // synthetic results with their minimum at (0.7, 120., 12.5)
+  std::vector<std::pair<std::vector<double>, calex::CalexResult>> results;
+  for (unsigned int i = 0; i < axes[0][2]; ++i)
+  {
+    for (unsigned int j = 0; j < axes[1][2]; ++j)
+    {
+      for (unsigned int k = 0; k < axes[2][2]; ++k)
+      {
+        std::vector<double> coordinates;
+        coordinates.push_back(axes[0][0]+i*axes[0][1]);
+        coordinates.push_back(axes[1][0]+j*axes[1][1]);
+        coordinates.push_back(axes[2][0]+k*axes[2][1]);
+        double const rms = 0.005+
+          std::fabs(coordinates[0]-0.7)+std::fabs(coordinates[1]-120.)*1e-3+
+          std::fabs(coordinates[2]-12.5)*1e-4+(i+j+k)*1e-7;
+        calex::CalexResult::TsystemParameters params;
+        params.push_back(std::make_pair("per", coordinates[1]+0.25));
+        params.push_back(std::make_pair("dmp", coordinates[0]-0.01));
+        calex::CalexResult result(10+k, rms, params);
+        // the node with the smallest RMS of all failed
+        if (i == 2 && j == 2 && k == 1) { result.set_exitStatus(256); }
+        results.push_back(std::make_pair(coordinates, result));
+      }
+    }
+  }
+  size_t stored = 0;
+  for (auto cit(results.cbegin()); cit != results.cend(); ++cit)
+  {
+    if (store.store(cit->first, cit->second)) { ++stored; }
+  }
+  std::vector<double> outside(results[0].first);
+  outside[1] = 95.;
+  std::cout << "stored: " << stored << ", outside: "
+    << store.store(outside, results[0].second) << ", other dimension: "
+    << store.store(std::vector<double>(2, 0.5), results[0].second)
+    << std::endl;
+
+  // traverse all results
+  size_t best = calex::ResultStore::npos;
+  double best_rms = HUGE_VAL;
+  size_t below = 0;
+  for (size_t i = 0; i < results.size(); ++i)
+  {
+    calex::CalexResult const& result(results[i].second);
+    if (! result.isComputed()) { continue; }
+    if (result.get_rms() < best_rms)
+    {
+      best = store.index(results[i].first);
+      best_rms = result.get_rms();
+    }
+    if (result.get_rms() <= 0.0155) { ++below; }
+  }
+
+  size_t const argmin = store.argmin();
+  std::vector<double> coordinates(store.coordinates(argmin));
+  std::cout << "argmin: " << argmin << " ("
+    << (best == argmin ? "identical" : "DIFFERENT") << ") at "
+    << coordinates[0] << " " << coordinates[1] << " " << coordinates[2]
+    << " rms " << store.get_rms()[argmin] << " iter "
+    << store.get_iter()[argmin] << std::endl;
+  std::cout << "status of failed node: "
+    << static_cast<int>(store.get_status()[store.index(results[37].first)])
+    << std::endl;
+  print("top 5", store.topk(5));
+  std::vector<size_t> filtered(store.filter(0.0155));
+  std::cout << "filter: " << filtered.size() << " nodes ("
+    << (below == filtered.size() ? "identical" : "DIFFERENT") << ")"
+    << std::endl;
+  for (unsigned int d = 0; d < store.get_dimensions(); ++d)
+  {
+    std::vector<double> minima(store.marginalMinima(d));
+    std::cout << "marginal minima " << d << ":";
+    for (auto cit(minima.cbegin()); cit != minima.cend(); ++cit)
+    {
+      std::cout << " " << *cit;
+    }
+    std::cout << std::endl;
+  }
+  calex::ResultSchema const* schema(store.get_schema());
+  for (size_t i = 0; schema && i < schema->size(); ++i)
+  {
+    std::cout << (*schema)[i] << " of argmin: "
+      << store.get_column(i)[argmin] << std::endl;
+  }
+  return 0;
+} // function main
+
+/* ----- END OF calexResultStoreTest.cc  ----- */
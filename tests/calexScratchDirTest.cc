@@ -0,0 +1,129 @@
+/*! \file calexScratchDirTest.cc
+ * \brief Test of isolated scratch directories for calex runs.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Test of isolated scratch directories for calex runs. Names of
+ *          scratch directories must be unique within a thread and across
+ *          threads. Symbolic links must resolve to their targets and only
+ *          the links must be removed together with the directory.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <set>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <boost/thread.hpp>
+#include <calexxx/scratchdir.h>
+
+namespace
+{
+  //! check if a path exists
+  bool exists(std::string const& path)
+  {
+    struct stat st;
+    return 0 == lstat(path.c_str(), &st);
+  } // function exists
+
+  /* ----------------------------------------------------------------------- */
+  //! create scratch directories and collect their names
+  void create(std::vector<std::string>* names, int const n)
+  {
+    for (int i = 0; i < n; ++i)
+    {
+      calex::ScratchDirectory scratch(".", "calexScratchDirTest");
+      names->push_back(scratch.get_path());
+    }
+  } // function create
+
+} // namespace (unnamed)
+
+/* ------------------------------------------------------------------------- */
+int main(int iargc, char* argv[])
+{
+  // unique names within a thread and across threads
+  std::vector<std::vector<std::string>> names(4);
+  boost::thread_group group;
+  for (size_t t = 1; t < names.size(); ++t)
+  {
+    group.create_thread(boost::bind(&create, &names[t], 50));
+  }
+  create(&names[0], 50);
+  group.join_all();
+  std::set<std::string> unique;
+  size_t count = 0;
+  for (auto cit(names.cbegin()); cit != names.cend(); ++cit)
+  {
+    unique.insert(cit->begin(), cit->end());
+    count += cit->size();
+  }
+  std::cout << "names: " << count << " unique: " << unique.size()
+    << std::endl;
+  size_t left = 0;
+  for (auto cit(unique.cbegin()); cit != unique.cend(); ++cit)
+  {
+    if (exists(*cit)) { ++left; }
+  }
+  std::cout << "directories left after destruction: " << left << std::endl;
+
+  // symbolic links
+  std::string path;
+  {
+    calex::ScratchDirectory scratch(".", "calexScratchDirTest");
+    path = scratch.get_path();
+    std::cout << "directory created: " << exists(path) << std::endl;
+    scratch.link("calex.out", "calex.out");
+    char target[4096];
+    ssize_t n = readlink((path+"/calex.out").c_str(), target,
+        sizeof(target)-1);
+    target[n > 0 ? n : 0] = '\0';
+    std::cout << "link target absolute: " << ('/' == target[0])
+      << std::endl;
+    std::ifstream ifs((path+"/calex.out").c_str());
+    std::string line;
+    std::cout << "link readable: " << static_cast<bool>(getline(ifs, line))
+      << std::endl;
+    // a file created by calex
+    std::ofstream((path+"/synt").c_str()) << "synt" << std::endl;
+
+    // removal keeps the targets of links
+    scratch.remove();
+    std::cout << "directory removed: " << ! exists(path)
+      << "  link target kept: " << exists("calex.out") << std::endl;
+  }
+
+  return 0;
+} // function main
+
+/* ----- END OF calexScratchDirTest.cc  ----- */
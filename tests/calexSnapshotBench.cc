@@ -0,0 +1,175 @@
+/*! \file calexSnapshotBench.cc
+ * \brief Benchmark of generating calex parameter files concurrently.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Benchmark of generating calex parameter files concurrently.
+ *          Parameter files per second are measured depending on the number
+ *          of threads, either updating the shared configuration under a
+ *          mutex, rendering from an immutable calex::ConfigSnapshot or
+ *          patching the snapshot's precompiled template. Parameter files are
+ *          rendered into memory.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 17/10/2026  V0.2  measure patching the precompiled template
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <chrono>
+#include <boost/thread.hpp>
+#include <calexxx/calexconfig.h>
+#include <calexxx/snapshot.h>
+#include <calexxx/subsystem.h>
+#include <calexxx/systemparameter.h>
+
+namespace
+{
+  //! generation mode
+  enum Emode { LOCKED, SNAPSHOT, TEMPLATE };
+
+  //! shared state of the benchmark
+  struct Setup
+  {
+    calex::CalexConfig* Mconfig;
+    std::shared_ptr<calex::SystemParameter> Mper;
+    std::shared_ptr<calex::SystemParameter> Mdmp;
+    boost::mutex Mmutex;
+  }; // struct Setup
+
+  /* ----------------------------------------------------------------------- */
+  //! worker generating \a n parameter files
+  void worker(Emode mode, Setup* setup, int n, size_t* bytes)
+  {
+    std::shared_ptr<calex::ConfigSnapshot const> snapshot(
+        setup->Mconfig->get_snapshot());
+    std::vector<double> coordinates(2);
+    std::string buffer;
+    for (int i = 0; i < n; ++i)
+    {
+      coordinates[0] = 100.+0.01*i;
+      coordinates[1] = 0.5+1e-5*i;
+      if (TEMPLATE == mode)
+      {
+        snapshot->render(buffer, coordinates, snapshot->get_infile(),
+            snapshot->get_outfile());
+        *bytes += buffer.size();
+        continue;
+      }
+      std::ostringstream oss;
+      if (SNAPSHOT == mode)
+      {
+        snapshot->write(oss, coordinates);
+      }
+      else
+      {
+        // what calex::CalexConfig::update does to the shared configuration
+        boost::lock_guard<boost::mutex> lock(setup->Mmutex);
+        setup->Mper->set_val(coordinates[0]);
+        setup->Mdmp->set_val(coordinates[1]);
+        oss << *setup->Mconfig;
+      }
+      *bytes += oss.str().size();
+    }
+  } // function worker
+
+  /* ----------------------------------------------------------------------- */
+  //! measure parameter files per second
+  double measure(Emode mode, Setup* setup, int files, int threads)
+  {
+    std::vector<size_t> bytes(threads, 0);
+    auto start(std::chrono::steady_clock::now());
+    boost::thread_group group;
+    for (int t = 0; t < threads; ++t)
+    {
+      group.create_thread(boost::bind(&worker, mode, setup, files/threads,
+            &bytes[t]));
+    }
+    group.join_all();
+    std::chrono::duration<double> elapsed(
+        std::chrono::steady_clock::now()-start);
+    return (files/threads)*threads/elapsed.count();
+  } // function measure
+
+} // namespace (unnamed)
+
+/* ------------------------------------------------------------------------- */
+int main(int iargc, char* argv[])
+{
+  if (iargc > 1 && 0 == strcmp(argv[1], "-h"))
+  {
+    std::cout << "Usage: calexSnapshotBench [FILES [THREADS ...]]"
+      << std::endl;
+    return 0;
+  }
+  int files = iargc > 1 ? atoi(argv[1]) : 200000;
+  std::vector<int> threads;
+  for (int i = 2; i < iargc; ++i) { threads.push_back(atoi(argv[i])); }
+  if (threads.empty())
+  {
+    threads.push_back(1); threads.push_back(2); threads.push_back(4);
+    threads.push_back(8);
+  }
+
+  // STS-2 like configuration with period and damping as grid parameters
+  calex::CalexConfig config("input.sfe", "output.sfe");
+  config.set_comment("calex snapshot benchmark");
+  config.set_amp(std::shared_ptr<calex::SystemParameter>(
+        new calex::SystemParameter("amp", -41.5, 5.1)));
+  Setup setup;
+  setup.Mconfig = &config;
+  setup.Mper.reset(new calex::GridSystemParameter("per", 1., "per", 100.,
+        140., 1., "s", 0));
+  setup.Mdmp.reset(new calex::GridSystemParameter("dmp", 0.01, "dmp", 0.5,
+        0.9, 0.01, "", 1));
+  config.add_subsystem(std::shared_ptr<calex::CalexSubsystem>(
+        new calex::SecondOrderSubsystem(calex::BP, setup.Mper, setup.Mdmp)));
+  config.freeze();
+
+  std::cout << "files: " << files << "\n" << std::setw(10) << "threads"
+    << std::setw(14) << "locked/s" << std::setw(14) << "snapshot/s"
+    << std::setw(14) << "template/s" << std::endl;
+  for (auto cit(threads.cbegin()); cit != threads.cend(); ++cit)
+  {
+    std::cout << std::setw(10) << *cit << std::fixed << std::setprecision(1)
+      << std::setw(14) << measure(LOCKED, &setup, files, *cit)
+      << std::setw(14) << measure(SNAPSHOT, &setup, files, *cit)
+      << std::setw(14) << measure(TEMPLATE, &setup, files, *cit)
+      << std::endl;
+  }
+  return 0;
+} // function main
+
+/* ----- END OF calexSnapshotBench.cc  ----- */
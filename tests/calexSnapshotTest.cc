@@ -0,0 +1,207 @@
+/*! \file calexSnapshotTest.cc
+ * \brief Test of rendering calex parameter files from a snapshot.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Test of rendering calex parameter files from a snapshot. The
+ *          parameter files rendered by calex::ConfigSnapshot are compared to
+ *          the ones written by calex::CalexConfig for several coordinates,
+ *          including values too wide for the template's slots and a
+ *          subgrid fixing a grid system parameter. Modifying the
+ *          configuration refreezes the snapshot, structural changes discard
+ *          it.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 17/10/2026  V0.2  Test snapshot of a subgrid.
+ * 17/10/2026  V0.3  Test refreezing a modified configuration.
+ * 17/10/2026  V0.4  Test the template with LC_NUMERIC set to a comma locale.
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <clocale>
+#include <calexxx/calexconfig.h>
+#include <calexxx/snapshot.h>
+#include <calexxx/subsystem.h>
+#include <calexxx/systemparameter.h>
+#include <calexxx/error.h>
+
+int main(int iargc, char* argv[])
+{
+  calex::CalexConfig config("input.sfe", "output.sfe");
+  config.set_comment("calex snapshot test");
+  config.set_amp(std::shared_ptr<calex::SystemParameter>(
+        new calex::SystemParameter("amp", -41.5, 5.1)));
+  config.add_systemParameter(std::shared_ptr<calex::SystemParameter>(
+        new calex::SystemParameter("xyz", 3., 0.)));
+  // grid system parameters with coordinate ids as assigned by synchronizing
+  std::shared_ptr<calex::SystemParameter> per(new calex::GridSystemParameter(
+        "per", 1., "per", 100., 140., 1., "s", 1));
+  std::shared_ptr<calex::SystemParameter> dmp(new calex::GridSystemParameter(
+        "dmp", 0.01, "dmp", 0.5, 0.9, 0.01, "", 0));
+  std::shared_ptr<calex::SystemParameter> lp(new calex::GridSystemParameter(
+        "per", 1., "lp", 10., 20., 1., "s", 2));
+  config.add_subsystem(std::shared_ptr<calex::CalexSubsystem>(
+        new calex::SecondOrderSubsystem(calex::BP, per, dmp)));
+  config.add_subsystem(std::shared_ptr<calex::CalexSubsystem>(
+        new calex::FirstOrderSubsystem(calex::LP, lp)));
+  config.freeze();
+  std::shared_ptr<calex::ConfigSnapshot const> snapshot(
+      config.get_snapshot());
+
+  double const coords[][3] = {
+    {0.707, 120., 15.},
+    {0.5000005, 99.9999995, -0.0},
+    {1e-7, -12345.678901, 1e9},
+    {-99999.9999999, 123456.5, 17.25}};
+  for (size_t i = 0; i < sizeof(coords)/sizeof(coords[0]); ++i)
+  {
+    std::vector<double> coordinates(coords[i], coords[i]+3);
+    // what calex::CalexConfig::update does
+    dmp->set_val(coordinates[0]);
+    per->set_val(coordinates[1]);
+    lp->set_val(coordinates[2]);
+    std::ostringstream expected;
+    std::ostringstream relocated;
+    expected << config;
+    config.writeRelocated(relocated, "in.sfe", "out.sfe");
+
+    std::ostringstream written;
+    snapshot->write(written, coordinates);
+    std::string rendered;
+    snapshot->render(rendered, coordinates, snapshot->get_infile(),
+        snapshot->get_outfile());
+    std::string rendered_relocated;
+    snapshot->render(rendered_relocated, coordinates, "in.sfe", "out.sfe");
+
+    std::cout << "coordinates " << i << ": write "
+      << (expected.str() == written.str() ? "identical" : "DIFFERENT")
+      << ", template "
+      << (expected.str() == rendered ? "identical" : "DIFFERENT")
+      << ", relocated template "
+      << (relocated.str() == rendered_relocated ? "identical" : "DIFFERENT")
+      << std::endl;
+  }
+
+  // the C library formatting numbers with a decimal comma
+  char const* locales[] = {"de_DE.UTF-8", "de_DE.utf8", "de_DE",
+    "fr_FR.UTF-8", "fr_FR.utf8", "fr_FR"};
+  bool comma = false;
+  for (size_t i = 0; i < sizeof(locales)/sizeof(locales[0]) && ! comma; ++i)
+  {
+    comma = 0 != setlocale(LC_NUMERIC, locales[i]);
+  }
+  if (comma)
+  {
+    std::vector<double> coordinates(coords[0], coords[0]+3);
+    dmp->set_val(coordinates[0]);
+    per->set_val(coordinates[1]);
+    lp->set_val(coordinates[2]);
+    std::ostringstream expected;
+    expected << config;
+    std::string rendered;
+    snapshot->render(rendered, coordinates, snapshot->get_infile(),
+        snapshot->get_outfile());
+    std::cout << "comma locale: template "
+      << (expected.str() == rendered ? "identical" : "DIFFERENT")
+      << std::endl;
+    setlocale(LC_NUMERIC, "C");
+  } else
+  {
+    std::cout << "comma locale: not available" << std::endl;
+  }
+
+  // subgrid varying the period of the second order subsystem and the
+  // first order subsystem only - damping is fixed
+  std::vector<unsigned int> varied;
+  varied.push_back(2);
+  varied.push_back(1);
+  std::vector<double> fixed(coords[0], coords[0]+3);
+  calex::ConfigSnapshot subgrid(config, varied, fixed);
+  std::vector<double> subcoordinates;
+  subcoordinates.push_back(12.5);
+  subcoordinates.push_back(130.);
+  dmp->set_val(fixed[0]);
+  per->set_val(subcoordinates[1]);
+  lp->set_val(subcoordinates[0]);
+  std::ostringstream expected;
+  expected << config;
+  std::string rendered;
+  subgrid.render(rendered, subcoordinates, subgrid.get_infile(),
+      subgrid.get_outfile());
+  std::cout << "subgrid (" << subgrid.get_dimensions() << " dimensions): "
+    << (expected.str() == rendered ? "identical" : "DIFFERENT") << std::endl;
+
+  // settings modified after freezing
+  config.set_maxit(42);
+  config.set_comment("calex snapshot test (modified)");
+  config.add_systemParameter(std::shared_ptr<calex::SystemParameter>(
+        new calex::SystemParameter("uvw", 2.5, 0.)));
+  std::shared_ptr<calex::ConfigSnapshot const> refrozen(
+      config.get_snapshot());
+  std::vector<double> coordinates(coords[0], coords[0]+3);
+  dmp->set_val(coordinates[0]);
+  per->set_val(coordinates[1]);
+  lp->set_val(coordinates[2]);
+  std::ostringstream modified;
+  modified << config;
+  std::string stale;
+  snapshot->render(stale, coordinates, snapshot->get_infile(),
+      snapshot->get_outfile());
+  rendered.clear();
+  refrozen->render(rendered, coordinates, refrozen->get_infile(),
+      refrozen->get_outfile());
+  std::cout << "modified: former snapshot "
+    << (modified.str() == stale ? "IDENTICAL" : "different")
+    << ", refrozen snapshot "
+    << (modified.str() == rendered ? "identical" : "DIFFERENT")
+    << std::endl;
+
+  // a grid system parameter added discards the snapshot
+  calex::Exception::dont_report_on_construct();
+  config.add_subsystem(std::shared_ptr<calex::CalexSubsystem>(
+        new calex::FirstOrderSubsystem(calex::HP,
+          std::shared_ptr<calex::SystemParameter>(
+            new calex::GridSystemParameter(
+              "per", 1., "hp", 1., 2., 0.5, "s", 3)))));
+  bool discarded = false;
+  try { config.get_snapshot(); }
+  catch (calex::Exception&) { discarded = true; }
+  std::cout << "grid system parameter added: snapshot "
+    << (discarded ? "discarded" : "NOT DISCARDED") << std::endl;
+
+  std::cout << std::endl << config;
+
+  return 0;
+} // function main
+
+/* ----- END OF calexSnapshotTest.cc  ----- */
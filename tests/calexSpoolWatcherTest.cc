@@ -0,0 +1,111 @@
+/*! \file calexSpoolWatcherTest.cc
+ * \brief Test of the watcher of a calex output spool directory.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Test of the watcher of a calex output spool directory. Files are
+ *          dropped into a scratch directory before and after the watcher
+ *          was constructed. A second watcher sharing the state file must
+ *          not report the files committed by the first one.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <calexxx/spoolwatcher.h>
+#include <calexxx/scratchdir.h>
+
+namespace
+{
+  //! print the names of the files reported
+  void print(std::string const& label, std::vector<std::string> const& names)
+  {
+    std::cout << label << ":";
+    for (auto cit(names.cbegin()); cit != names.cend(); ++cit)
+    {
+      std::cout << " " << *cit;
+    }
+    std::cout << std::endl;
+  } // function print
+
+  /* ----------------------------------------------------------------------- */
+  //! drop a file into the spool directory
+  void drop(calex::SpoolWatcher const& watcher, std::string const& name)
+  {
+    std::ofstream ofs(watcher.path(name).c_str());
+    ofs << "final system parameters" << std::endl;
+  } // function drop
+
+} // namespace (unnamed)
+
+/* ------------------------------------------------------------------------- */
+int main(int iargc, char* argv[])
+{
+  calex::ScratchDirectory scratch(".", "calexSpoolWatcherTest");
+  std::string const state("calexSpoolWatcherTest.state");
+  remove(state.c_str());
+  std::vector<std::string> names;
+  {
+    calex::SpoolWatcher watcher(scratch.get_path(), state);
+    drop(watcher, "b.out");
+    drop(watcher, "a.out");
+    drop(watcher, "a.txt");
+    watcher.scan(names);
+    print("scan", names);
+    watcher.commit(names);
+
+    // files closed after the scan
+    drop(watcher, "c.out");
+    drop(watcher, "d.out");
+    watcher.wait(names, 1000);
+    print("wait", names);
+    watcher.commit(std::vector<std::string>(1, "c.out"));
+    std::cout << "ingested: " << watcher.get_count() << std::endl;
+    watcher.wait(names, 100);
+    print("wait (timeout)", names);
+  }
+
+  // restart
+  calex::SpoolWatcher watcher(scratch.get_path(), state);
+  std::cout << "ingested after restart: " << watcher.get_count()
+    << std::endl;
+  watcher.scan(names);
+  print("scan after restart", names);
+  rename(watcher.path("a.txt").c_str(), watcher.path("e.out").c_str());
+  watcher.wait(names, 1000);
+  print("wait (moved)", names);
+  remove(state.c_str());
+  return 0;
+} // function main
+
+/* ----- END OF calexSpoolWatcherTest.cc  ----- */
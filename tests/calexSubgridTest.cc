@@ -0,0 +1,174 @@
+/*! \file calexSubgridTest.cc
+ * \brief Test of visiting subgrids of the parameter space.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Test of visiting subgrids of the parameter space. Two subgrids of
+ *          the same dimension fixing the damping at different values are
+ *          visited concurrently by calex::SubgridVisitor. The nodes are
+ *          evaluated by the mock engine and every result must match the
+ *          result of the node evaluated with the snapshot of its own
+ *          subgrid.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026  V0.1  Daniel Armbruster
+ *
+ * ============================================================================
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <boost/thread.hpp>
+#include <optimizexx/gridsearch.h>
+#include <optimizexx/standardbuilder.h>
+#include <calexxx/calexconfig.h>
+#include <calexxx/calexvisitor.h>
+#include <calexxx/snapshot.h>
+#include <calexxx/engine.h>
+#include <calexxx/subsystem.h>
+#include <calexxx/systemparameter.h>
+
+typedef opt::Grid<double, calex::CalexResult> Tgrid;
+typedef opt::Node<double, calex::CalexResult> Tnode;
+
+namespace
+{
+  //! visit a subgrid
+  void visit(Tgrid* grid, calex::SubgridVisitor<double>* visitor)
+  {
+    grid->accept(*visitor);
+  } // function visit
+
+  /*-------------------------------------------------------------------------*/
+  /*!
+   * check the nodes of a subgrid against the nodes evaluated with the
+   * snapshot of the subgrid and of the other subgrid
+   */
+  void check(std::string const& name, calex::CalexConfig const& config,
+      std::vector<Tnode*> const& nodes,
+      calex::ConfigSnapshot const& own, calex::ConfigSnapshot const& other)
+  {
+    calex::MockEngine<double> engine;
+    size_t matching = 0;
+    size_t distinct = 0;
+    for (auto cit(nodes.cbegin()); cit != nodes.cend(); ++cit)
+    {
+      double const rms = (*cit)->getResultData().get_rms();
+      if ((*cit)->isComputed() && rms ==
+          engine.evaluate(config, own, (*cit)->getCoordinates()).get_rms())
+      {
+        ++matching;
+      }
+      if (rms !=
+          engine.evaluate(config, other, (*cit)->getCoordinates()).get_rms())
+      {
+        ++distinct;
+      }
+    }
+    std::cout << name << ": " << matching << " of " << nodes.size()
+      << " nodes match the subgrid's snapshot, " << distinct
+      << " differ from the other subgrid" << std::endl;
+  } // function check
+
+} // namespace
+
+/*===========================================================================*/
+int main(int iargc, char* argv[])
+{
+  calex::CalexConfig config("input.sfe", "output.sfe");
+  config.set_amp(std::shared_ptr<calex::SystemParameter>(
+        new calex::SystemParameter("amp", -41.5, 5.1)));
+  std::shared_ptr<calex::GridSystemParameter> per(
+      new calex::GridSystemParameter("per", 1., "per", 100., 140., 10.));
+  std::shared_ptr<calex::GridSystemParameter> dmp(
+      new calex::GridSystemParameter("dmp", 0.01, "dmp", 0.5, 0.9, 0.1));
+  std::shared_ptr<calex::GridSystemParameter> lp(
+      new calex::GridSystemParameter("per", 1., "lp", 10., 20., 5.));
+  config.add_subsystem(std::shared_ptr<calex::CalexSubsystem>(
+        new calex::SecondOrderSubsystem(calex::BP, per, dmp)));
+  config.add_subsystem(std::shared_ptr<calex::CalexSubsystem>(
+        new calex::FirstOrderSubsystem(calex::LP, lp)));
+  opt::GridSearch<double, calex::CalexResult> algo(
+      new opt::StandardParameterSpaceBuilder<double, calex::CalexResult>);
+  config.set_gridSystemParameters<double>(algo);
+  config.synchronize<double>(algo);
+
+  // both subgrids vary the periods and fix the damping
+  std::vector<unsigned int> varied;
+  varied.push_back(per->get_coordinateId());
+  varied.push_back(lp->get_coordinateId());
+  std::vector<double> fixed_a(3, 0.);
+  fixed_a[per->get_coordinateId()] = 120.;
+  fixed_a[lp->get_coordinateId()] = 15.;
+  std::vector<double> fixed_b(fixed_a);
+  fixed_a[dmp->get_coordinateId()] = 0.6;
+  fixed_b[dmp->get_coordinateId()] = 0.8;
+
+  // subgrids with identical node coordinates
+  Tgrid grid_a;
+  Tgrid grid_b;
+  std::vector<Tnode*> nodes_a;
+  std::vector<Tnode*> nodes_b;
+  for (double p = 100.; p <= 140.; p += 10.)
+  {
+    for (double l = 10.; l <= 20.; l += 5.)
+    {
+      std::vector<double> coordinates;
+      coordinates.push_back(p);
+      coordinates.push_back(l);
+      nodes_a.push_back(new Tnode(coordinates));
+      nodes_b.push_back(new Tnode(coordinates));
+      grid_a.add(nodes_a.back());
+      grid_b.add(nodes_b.back());
+    }
+  }
+
+  // nodes are evaluated by the mock engine; calex is never spawned
+  calex::CalexApplication<double> app(&config, false, "true");
+  app.set_engine(calex::createEngine<double>("mock"));
+  std::shared_ptr<calex::ConfigSnapshot const> snapshot_a(
+      config.get_snapshot(varied, fixed_a));
+  std::shared_ptr<calex::ConfigSnapshot const> snapshot_b(
+      config.get_snapshot(varied, fixed_b));
+  calex::SubgridVisitor<double> visitor_a(app, snapshot_a);
+  calex::SubgridVisitor<double> visitor_b(app, snapshot_b);
+  std::cout << "subgrids of " << snapshot_a->get_dimensions() << " and "
+    << snapshot_b->get_dimensions() << " dimensions" << std::endl;
+
+  boost::thread_group group;
+  group.create_thread(boost::bind(&visit, &grid_a, &visitor_a));
+  group.create_thread(boost::bind(&visit, &grid_b, &visitor_b));
+  group.join_all();
+
+  check("subgrid A (dmp 0.6)", config, nodes_a, *snapshot_a, *snapshot_b);
+  check("subgrid B (dmp 0.8)", config, nodes_b, *snapshot_b, *snapshot_a);
+
+  return 0;
+} // function main
+
+/* ----- END OF calexSubgridTest.cc  ----- */
@@ -0,0 +1,106 @@
+/*! \file calexWatchdogTest.cc
+ * \brief Testing run time limits and statistics of calex runs.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ * 
+ * Purpose: Testing run time limits and statistics of calex runs. Since the
+ * calex program itself may not be available standard system utilities are
+ * launched instead.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 17/10/2026  V0.1  Daniel Armbruster
+ * 17/10/2026  V0.2  run killed before reaching its CPU time limit
+ * 
+ * ============================================================================
+ */
+ 
+#include <iostream>
+#include <csignal>
+#include <calexxx/launcher.h>
+#include <calexxx/watchdog.h>
+#include <calexxx/resultdata.h>
+
+int main(int iargc, char* argv[])
+{
+  calex::CalexLauncher launcher("sleep");
+
+  // a run within its wall-clock limit
+  {
+    pid_t pid = launcher.spawn("0.1");
+    calex::Watchdog watchdog(pid, 5.);
+    std::cout << "sleep 0.1 (limit 5 s):   in time="
+      << watchdog.waitFor(-1);
+    std::cout << " success=" << calex::exitedSuccessfully(launcher.wait(pid))
+      << std::endl;
+  }
+
+  // a run exceeding its wall-clock limit
+  {
+    pid_t pid = launcher.spawn("5");
+    calex::Watchdog watchdog(pid, 0.2);
+    std::cout << "sleep 5 (limit 0.2 s):   in time="
+      << watchdog.waitFor(-1);
+    if (watchdog.expired()) { kill(pid, SIGKILL); }
+    calex::CalexResult result;
+    result.set_exitStatus(launcher.wait(pid));
+    if (watchdog.expired()) { result.set_timedOut(); }
+    std::cout << " timed out=" << (calex::TimedOut == result.get_status())
+      << std::endl;
+  }
+
+  // a run exceeding its CPU time limit
+  {
+    calex::CalexLauncher busy("yes");
+    pid_t pid = busy.spawn("y");
+    calex::limitCpuTime(pid, 1);
+    struct rusage usage;
+    int status = busy.wait(pid, &usage);
+    std::cout << "yes (CPU limit 1 s):     exceeded="
+      << calex::exceededCpuTime(status, usage, 1) << std::endl;
+  }
+
+  // a run killed otherwise (e.g. by the OOM killer) before its CPU limit
+  {
+    pid_t pid = launcher.spawn("5");
+    calex::limitCpuTime(pid, 1);
+    kill(pid, SIGKILL);
+    struct rusage usage;
+    int status = launcher.wait(pid, &usage);
+    std::cout << "sleep 5 (killed):        exceeded="
+      << calex::exceededCpuTime(status, usage, 1) << std::endl;
+  }
+
+  // latency statistics
+  calex::RunStatistics stats;
+  for (int i = 100; i > 0; --i) { stats.record(0.01*i, i > 98); }
+  std::cout << "p50=" << stats.percentile(50) << " p99="
+    << stats.percentile(99) << " max=" << stats.get_max() << std::endl;
+  std::cout << stats;
+
+  return 0;
+} // function main
+
+/* ----- END OF calexWatchdogTest.cc  ----- */
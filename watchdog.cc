@@ -0,0 +1,209 @@
+/*! \file watchdog.cc
+ * \brief Implementation of run time limits and statistics of calex runs.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Implementation of run time limits and statistics of calex runs.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  SIGKILL is attributed to the CPU time limit only if
+ *                    the limit was reached.
+ *
+ * ============================================================================
+ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <cerrno>
+#include <csignal>
+#include <ctime>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include <calexxx/watchdog.h>
+#include <calexxx/error.h>
+
+namespace calex
+{
+  /*=========================================================================*/
+  Watchdog::Watchdog(pid_t const pid, double const wall_time) :
+    MwallTime(wall_time), Mstart(monotonicTime()), Mpidfd(-1), Mexpired(false)
+  {
+    if (MwallTime > 0.)
+    {
+      Mpidfd = syscall(SYS_pidfd_open, pid, 0);
+      CALEX_assert(-1 != Mpidfd,
+          "Error while opening process file descriptor.");
+    }
+  }
+
+  /*-------------------------------------------------------------------------*/
+  Watchdog::~Watchdog()
+  {
+    if (-1 != Mpidfd) { close(Mpidfd); }
+  }
+
+  /*-------------------------------------------------------------------------*/
+  bool Watchdog::waitFor(int const fd)
+  {
+    if (Mexpired) { return false; }
+    // without limit the caller blocks while reading or waiting
+    if (MwallTime <= 0.) { return true; }
+    struct pollfd pfd;
+    pfd.fd = -1 != fd ? fd : Mpidfd;
+    pfd.events = POLLIN;
+    int retval;
+    do
+    {
+      double remaining = MwallTime-elapsed();
+      if (remaining <= 0.) { retval = 0; break; }
+      retval = poll(&pfd, 1, static_cast<int>(std::ceil(remaining*1e3)));
+    } while (-1 == retval && EINTR == errno);
+    CALEX_assert(-1 != retval, "Error while waiting for calex process.");
+    if (0 == retval) { Mexpired = true; }
+    return ! Mexpired;
+  } // function Watchdog::waitFor
+
+  /*-------------------------------------------------------------------------*/
+  double Watchdog::elapsed() const
+  {
+    return monotonicTime()-Mstart;
+  }
+
+  /*=========================================================================*/
+  void RunStatistics::record(double const seconds, bool const timed_out)
+  {
+    boost::lock_guard<boost::mutex> lock(Mmutex);
+    Mtimes.push_back(seconds);
+    if (timed_out) { ++MtimedOut; }
+  }
+
+  /*-------------------------------------------------------------------------*/
+  size_t RunStatistics::get_count() const
+  {
+    boost::lock_guard<boost::mutex> lock(Mmutex);
+    return Mtimes.size();
+  }
+
+  /*-------------------------------------------------------------------------*/
+  size_t RunStatistics::get_timedOut() const
+  {
+    boost::lock_guard<boost::mutex> lock(Mmutex);
+    return MtimedOut;
+  }
+
+  /*-------------------------------------------------------------------------*/
+  double RunStatistics::percentile(double const p) const
+  {
+    CALEX_assert(0. <= p && 100. >= p, "Illegal percentile.");
+    std::vector<double> times;
+    {
+      boost::lock_guard<boost::mutex> lock(Mmutex);
+      times = Mtimes;
+    }
+    if (times.empty()) { return 0.; }
+    size_t rank = static_cast<size_t>(std::ceil(p/100.*times.size()));
+    if (rank > 0) { --rank; }
+    std::nth_element(times.begin(), times.begin()+rank, times.end());
+    return times[rank];
+  } // function RunStatistics::percentile
+
+  /*-------------------------------------------------------------------------*/
+  double RunStatistics::get_max() const
+  {
+    boost::lock_guard<boost::mutex> lock(Mmutex);
+    if (Mtimes.empty()) { return 0.; }
+    return *std::max_element(Mtimes.begin(), Mtimes.end());
+  }
+
+  /*-------------------------------------------------------------------------*/
+  void RunStatistics::clear()
+  {
+    boost::lock_guard<boost::mutex> lock(Mmutex);
+    Mtimes.clear();
+    MtimedOut = 0;
+  }
+
+  /*-------------------------------------------------------------------------*/
+  void RunStatistics::write(std::ostream& os) const
+  {
+    std::ostringstream oss;
+    oss << "runs: " << get_count() << " (timed out: " << get_timedOut()
+      << ")" << std::fixed << std::setprecision(3)
+      << "  p50: " << percentile(50) << " s"
+      << "  p99: " << percentile(99) << " s"
+      << "  max: " << get_max() << " s";
+    os << oss.str() << std::endl;
+  } // function RunStatistics::write
+
+  /*-------------------------------------------------------------------------*/
+  std::ostream& operator<<(std::ostream& os, RunStatistics const& stats)
+  {
+    stats.write(os);
+    return os;
+  }
+
+  /*=========================================================================*/
+  void limitCpuTime(pid_t const pid, unsigned int const seconds)
+  {
+    struct rlimit limit;
+    limit.rlim_cur = seconds;
+    limit.rlim_max = seconds+1;
+    // the process may already have terminated
+    CALEX_assert(0 == prlimit(pid, RLIMIT_CPU, &limit, 0) || ESRCH == errno,
+        "Error while limiting CPU time of calex process.");
+  }
+
+  /*-------------------------------------------------------------------------*/
+  bool exceededCpuTime(int const status, struct rusage const& usage,
+      unsigned int const seconds)
+  {
+    if (! WIFSIGNALED(status) || 0 == seconds) { return false; }
+    if (SIGXCPU == WTERMSIG(status)) { return true; }
+    double const cpu = usage.ru_utime.tv_sec+1e-6*usage.ru_utime.tv_usec+
+      usage.ru_stime.tv_sec+1e-6*usage.ru_stime.tv_usec;
+    return SIGKILL == WTERMSIG(status) && cpu >= seconds;
+  }
+
+  /*-------------------------------------------------------------------------*/
+  double monotonicTime()
+  {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec+1e-9*ts.tv_nsec;
+  }
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+/* ----- END OF watchdog.cc  ----- */
@@ -0,0 +1,227 @@
+/*! \file watchdog.h
+ * \brief Declaration of run time limits and statistics of calex runs.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 17/10/2026
+ *
+ * Purpose: Declaration of run time limits and statistics of calex runs.
+ *
+ * ----
+ * This file is part of libcalexxx.
+ *
+ * libcalexxx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcalexxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcalexxx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 17/10/2026   V0.1  Daniel Armbruster
+ * 17/10/2026   V0.2  SIGKILL is attributed to the CPU time limit only if
+ *                    the limit was reached.
+ *
+ * ============================================================================
+ */
+
+
+#include <iostream>
+#include <vector>
+#include <sys/types.h>
+#include <sys/resource.h>
+#include <boost/thread.hpp>
+#include <calexxx/error.h>
+
+#ifndef _CALEX_WATCHDOG_H_
+#define _CALEX_WATCHDOG_H_
+
+namespace calex
+{
+  /*=========================================================================*/
+  /*!
+   * Run time limits of a single calex run. A limit of zero means unlimited.
+   */
+  struct RunLimits
+  {
+    /*!
+     * constructor
+     *
+     * \param wall_time wall-clock time limit in seconds
+     * \param cpu_time CPU time limit in seconds
+     */
+    RunLimits(double const wall_time=0., unsigned int const cpu_time=0) :
+      MwallTime(wall_time), McpuTime(cpu_time)
+    { }
+    //! wall-clock time limit in seconds
+    double MwallTime;
+    /*!
+     * CPU time limit in seconds enforced by means of \c RLIMIT_CPU (see
+     * calex::limitCpuTime)
+     */
+    unsigned int McpuTime;
+
+  }; // struct RunLimits
+
+  /*=========================================================================*/
+  /*!
+   * Watchdog enforcing the wall-clock time limit of a running calex process.
+   *
+   * The watchdog waits for output of calex or for its termination until the
+   * deadline expired. Termination is detected by means of a process file
+   * descriptor (\c pidfd_open) which also works for processes spawned by a
+   * calex::CalexForkServer. The watchdog itself does not kill the process.
+   *
+   * \code
+   * Watchdog watchdog(pid, limits.MwallTime);
+   * if (! watchdog.waitFor(channel.get_fd())) { kill(pid, SIGKILL); }
+   * \endcode
+   */
+  class Watchdog
+  {
+    public:
+      /*!
+       * constructor - starts the clock
+       *
+       * \param pid process id of the calex process
+       * \param wall_time wall-clock time limit in seconds (zero means
+       * unlimited)
+       */
+      Watchdog(pid_t const pid, double const wall_time=0.);
+      //! destructor
+      ~Watchdog();
+      /*!
+       * wait until data is available or the process terminated
+       *
+       * \param fd Descriptor calex output is read from. If -1 only the
+       * termination of the process is awaited.
+       *
+       * \return false if the deadline expired
+       */
+      bool waitFor(int const fd);
+      //! query function if the deadline expired
+      bool expired() const { return Mexpired; }
+      //! query function for the seconds elapsed since construction
+      double elapsed() const;
+
+    private:
+      //! copying is not allowed
+      Watchdog(Watchdog const&);
+      Watchdog& operator=(Watchdog const&);
+
+    private:
+      //! wall-clock time limit in seconds
+      double MwallTime;
+      //! start time in seconds (monotonic clock)
+      double Mstart;
+      //! process file descriptor
+      int Mpidfd;
+      //! flag if the deadline expired
+      bool Mexpired;
+
+  }; // class Watchdog
+
+  /*=========================================================================*/
+  /*!
+   * Thread-safe latency statistics of calex runs.
+   *
+   * The wall-clock times of all runs are kept such that exact percentiles
+   * can be reported, e.g. to tune calex::RunLimits.
+   */
+  class RunStatistics
+  {
+    public:
+      //! constructor
+      RunStatistics() : MtimedOut(0) { }
+      /*!
+       * record a run
+       *
+       * \param seconds wall-clock time of the run
+       * \param timed_out flag if the run exceeded its limits
+       */
+      void record(double const seconds, bool const timed_out=false);
+      //! query function for the number of runs recorded
+      size_t get_count() const;
+      //! query function for the number of runs which timed out
+      size_t get_timedOut() const;
+      /*!
+       * query function for a percentile of the wall-clock times
+       *
+       * \param p percentile in the range [0,100]
+       *
+       * \return wall-clock time in seconds (nearest-rank method)
+       */
+      double percentile(double const p) const;
+      //! query function for the maximum wall-clock time in seconds
+      double get_max() const;
+      //! remove all records
+      void clear();
+      /*!
+       * write statistics (count, p50, p99, max) to an outputstream
+       *
+       * \param os output stream
+       */
+      void write(std::ostream& os) const;
+
+    private:
+      //! wall-clock times in seconds
+      std::vector<double> Mtimes;
+      //! number of runs which timed out
+      size_t MtimedOut;
+      //! mutual exclusion variable to guarantee thread safety
+      mutable boost::mutex Mmutex;
+
+  }; // class RunStatistics
+
+  //! output stream operator
+  std::ostream& operator<<(std::ostream& os, RunStatistics const& stats);
+
+  /*=========================================================================*/
+  /*!
+   * Limit the CPU time of a running process by means of \c prlimit.
+   *
+   * The process receives \c SIGXCPU when the limit is reached and \c SIGKILL
+   * one second later.
+   *
+   * \param pid process id
+   * \param seconds CPU time limit in seconds
+   */
+  void limitCpuTime(pid_t const pid, unsigned int const seconds);
+
+  /*!
+   * Check if a process was terminated by its CPU time limit.
+   *
+   * \c SIGXCPU is sent when the soft limit is reached. \c SIGKILL is sent
+   * when the hard limit is reached but also e.g. by the OOM killer or an
+   * operator. It is attributed to the limit only if the CPU time consumed
+   * reached the limit.
+   *
+   * \param status raw wait status as returned by \c wait4
+   * \param usage resource usage as returned by \c wait4
+   * \param seconds CPU time limit in seconds as passed to
+   * calex::limitCpuTime
+   */
+  bool exceededCpuTime(int const status, struct rusage const& usage,
+      unsigned int const seconds);
+
+  //! current time of the monotonic clock in seconds
+  double monotonicTime();
+
+  /*=========================================================================*/
+
+} // namespace calex
+
+#endif // include guard
+
+/* ----- END OF watchdog.h  ----- */